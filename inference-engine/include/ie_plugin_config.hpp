@@ -10,6 +10,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -156,6 +157,30 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get the number of reorders the CPU plugin avoided or removed while compiling the network.
+ * String value is "CPU_ELIMINATED_REORDERS". CPU plugin only, other plugins do not list it in SUPPORTED_METRICS.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_ELIMINATED_REORDERS, unsigned int);
+
+/**
+ * @brief Metric to get the number of bytes the reorders remaining in the CPU graph move per inference.
+ * String value is "CPU_REORDERED_BYTES". CPU plugin only, other plugins do not list it in SUPPORTED_METRICS.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_REORDERED_BYTES, uint64_t);
+
+/**
+ * @brief Metric to get the number of execution steps of the CPU latency mode, 0 if the network is executed node by node.
+ * String value is "CPU_LATENCY_PLAN_STEPS". CPU plugin only, other plugins do not list it in SUPPORTED_METRICS.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_LATENCY_PLAN_STEPS, unsigned int);
+
+/**
+ * @brief Metric to get the number of graphs the CPU plugin has compiled for the executable network so far.
+ * String value is "CPU_COMPILED_GRAPHS". CPU plugin only, other plugins do not list it in SUPPORTED_METRICS.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_COMPILED_GRAPHS, unsigned int);
+
 }  // namespace Metrics
 
 /**
@@ -360,5 +385,77 @@ DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
  */
 DECLARE_CONFIG_KEY(ENFORCE_BF16);
 
+/**
+ * @brief The name for setting the compressed precision of FullyConnected weights (CPU plugin only)
+ *
+ * Possible values: NO (default), WEIGHTS_COMPRESSION_I8 (int8 weights with a per output channel scale) or
+ * WEIGHTS_COMPRESSION_BF16 (bfloat16 weights). Activations stay in FP32 and the weights are decompressed
+ * on the fly, so bandwidth bound layers (e.g. small batch inference) read less memory.
+ * Such option do not guarantee accuracy of the network, the accuracy in this mode should be
+ * verified separately by the user
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_COMPRESSION);
+DECLARE_CONFIG_VALUE(WEIGHTS_COMPRESSION_I8);
+DECLARE_CONFIG_VALUE(WEIGHTS_COMPRESSION_BF16);
+
+/**
+ * @brief The name for setting a directory the CPU plugin shares prepared weights through (CPU plugin only)
+ *
+ * Weights reordered to the layout of the selected implementation are saved to the directory and other
+ * processes loading the same weights map them read-only instead of preparing their own copy. Set on the
+ * plugin level (via SetConfig) the option applies to all networks loaded after it, passed to LoadNetwork it
+ * applies to that network only. The weights of a network are cached even if it is executed by a single stream.
+ * Empty string (default) keeps the weights shared between the networks of the process only, and only for the
+ * networks executed by several streams.
+ * A file is mapped only if it was written by the same build on a CPU with the same ISA and its checksum is
+ * valid, otherwise it is rewritten. The plugin never removes the files, cleaning the directory up is up to
+ * the user.
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_CACHE_DIR);
+
+/**
+ * @brief This key enables the detailed profiling of the nodes execution (CPU plugin only)
+ *
+ * Value is a prefix of the output files. Every call of GetPerformanceCounts writes a chrome trace of the
+ * latest node executions to `<prefix>_<network_name>_<graph_id>_trace.json` and a roofline report with the
+ * latency distribution, the bytes moved and the operations done by every node to
+ * `<prefix>_<network_name>_<graph_id>_roofline.json`, the characters of the network name which are not letters,
+ * digits, '-', '_' or '.' are replaced by '_'. Empty string (default) disables the report.
+ */
+DECLARE_CONFIG_KEY(CPU_PROFILING_REPORT);
+
+/**
+ * @brief The name for setting a calibration dataset for the bfloat16 execution (CPU plugin only)
+ *
+ * Value is a path to a file with FP32 samples of the network inputs. Every sample holds the data of all the
+ * inputs in the order of their names, each one in the plain (NCHW-like) layout of its dimensions. When
+ * ENFORCE_BF16 is enabled, the samples are inferred in FP32 and in bfloat16 and the layers adding more error
+ * than CPU_BF16_CALIBRATION_THRESHOLD are kept in FP32. The resulting precision of every layer is reported
+ * by the runtimePrecision field of the execution graph. Empty string (default) selects the bfloat16 layers
+ * by their types only.
+ */
+DECLARE_CONFIG_KEY(CPU_BF16_CALIBRATION_DATA);
+
+/**
+ * @brief The name for setting the maximal relative RMS error of the bfloat16 calibration (CPU plugin only)
+ *
+ * Value is a positive floating point number, "0.01" by default. A layer is kept in FP32 when running it in
+ * bfloat16 increases the error of its output by more than this value, and more layers are kept in FP32 while
+ * the error of a network output exceeds it. Used together with CPU_BF16_CALIBRATION_DATA only.
+ */
+DECLARE_CONFIG_KEY(CPU_BF16_CALIBRATION_THRESHOLD);
+
+/**
+ * @brief The name for enabling the latency mode of the CPU plugin
+ *
+ * Value is YES or NO (default). In the latency mode the synchronous Infer runs on the calling thread instead of
+ * a stream executor thread, and the graph is executed by a flat list of calls bound at LoadNetwork time without
+ * the per-layer bookkeeping. Every infer request is bound to a graph of its own: the graphs compiled for the streams
+ * are bound first, a new graph is compiled by CreateInferRequest when there are more requests than streams.
+ * Intended for batch 1 requests to small networks, where this overhead is comparable to the computation itself.
+ * Has no effect when PERF_COUNT, DYN_BATCH_ENABLED or CPU_PROFILING_REPORT are set.
+ */
+DECLARE_CONFIG_KEY(CPU_LATENCY_MODE);
+
 }  // namespace PluginConfigParams
 }  // namespace InferenceEngine
@@ -9,13 +9,57 @@
 #include "cpu_x86_sse42/blob_transform_sse42.hpp"
 #endif
 
+#include "ie_parallel.hpp"
+
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 
 //----------------------------------------------------------------------
 
 namespace InferenceEngine {
 
+// The tile is small enough to keep both source and destination lines in L1 while transposing
+static constexpr size_t transpose_block = 16;
+
+// Copies one interleaved row (W x C) into C planar rows
+template <typename data_t>
+static inline void blob_copy_row_split(const data_t* src_ptr, data_t* dst_ptr, size_t C_src_stride, size_t W_src_stride,
+                                       size_t C_dst_stride, size_t C, size_t W) {
+    for (size_t c0 = 0; c0 < C; c0 += transpose_block) {
+        const size_t c1 = (std::min)(C, c0 + transpose_block);
+        for (size_t w0 = 0; w0 < W; w0 += transpose_block) {
+            const size_t w1 = (std::min)(W, w0 + transpose_block);
+            for (size_t c = c0; c < c1; c++) {
+                const data_t* src_ptr_l = src_ptr + c * C_src_stride;
+                data_t* dst_ptr_l = dst_ptr + c * C_dst_stride;
+                for (size_t w = w0; w < w1; w++) {
+                    dst_ptr_l[w] = src_ptr_l[w * W_src_stride];
+                }
+            }
+        }
+    }
+}
+
+// Copies C planar rows into one interleaved row (W x C)
+template <typename data_t>
+static inline void blob_copy_row_merge(const data_t* src_ptr, data_t* dst_ptr, size_t C_src_stride, size_t C_dst_stride,
+                                       size_t W_dst_stride, size_t C, size_t W) {
+    for (size_t w0 = 0; w0 < W; w0 += transpose_block) {
+        const size_t w1 = (std::min)(W, w0 + transpose_block);
+        for (size_t c0 = 0; c0 < C; c0 += transpose_block) {
+            const size_t c1 = (std::min)(C, c0 + transpose_block);
+            for (size_t w = w0; w < w1; w++) {
+                data_t* dst_ptr_l = dst_ptr + w * W_dst_stride;
+                for (size_t c = c0; c < c1; c++) {
+                    dst_ptr_l[c * C_dst_stride] = src_ptr[c * C_src_stride + w];
+                }
+            }
+        }
+    }
+}
+
 template <InferenceEngine::Precision::ePrecision PRC>
 static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
@@ -47,22 +91,28 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     const auto H_dst_stride = dst_l == NHWC ? dst_strides[1] : dst_strides[2];
     const auto W_dst_stride = dst_l == NHWC ? dst_strides[2] : dst_strides[3];
 
-    src_ptr += dst_blk_desc.getOffsetPadding();
+    dst_ptr += dst_blk_desc.getOffsetPadding();
 
 #ifdef HAVE_SSE
     if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW && C == 3 &&
         C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
         if (PRC == Precision::U8) {
-            blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
-                                    static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
+            parallel_for2d(N, H, [&](size_t n, size_t h) {
+                blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr + n * N_src_stride + h * H_src_stride),
+                                        reinterpret_cast<uint8_t*>(dst_ptr + n * N_dst_stride + h * H_dst_stride),
+                                        N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
+                                        1, 1, static_cast<int>(W));
+            });
             return;
         }
 
         if (PRC == Precision::FP32) {
-            blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
-                                     static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
+            parallel_for2d(N, H, [&](size_t n, size_t h) {
+                blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr + n * N_src_stride + h * H_src_stride),
+                                         reinterpret_cast<float*>(dst_ptr + n * N_dst_stride + h * H_dst_stride),
+                                         N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
+                                         1, 1, static_cast<int>(W));
+            });
             return;
         }
     }
@@ -70,55 +120,41 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC && C == 3 &&
         C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
         if (PRC == Precision::U8) {
-            blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
-                                    static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
+            parallel_for2d(N, H, [&](size_t n, size_t h) {
+                blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr + n * N_src_stride + h * H_src_stride),
+                                        reinterpret_cast<uint8_t*>(dst_ptr + n * N_dst_stride + h * H_dst_stride),
+                                        N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
+                                        1, 1, static_cast<int>(W));
+            });
             return;
         }
 
         if (PRC == Precision::FP32) {
-            blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
-                                     static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
+            parallel_for2d(N, H, [&](size_t n, size_t h) {
+                blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr + n * N_src_stride + h * H_src_stride),
+                                         reinterpret_cast<float*>(dst_ptr + n * N_dst_stride + h * H_dst_stride),
+                                         N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
+                                         1, 1, static_cast<int>(W));
+            });
             return;
         }
     }
 #endif  // HAVE_SSE
 
     if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (int h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
-                    }
-                }
-            }
-        }
+        parallel_for2d(N, H, [&](size_t n, size_t h) {
+            blob_copy_row_split(src_ptr + n * N_src_stride + h * H_src_stride,
+                                dst_ptr + n * N_dst_stride + h * H_dst_stride,
+                                C_src_stride, W_src_stride, C_dst_stride, C, W);
+        });
     } else if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c;
-                for (int h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        dst_ptr_l += W_dst_stride;
-                        src_ptr_l_l++;
-                    }
-                }
-            }
-        }
+        parallel_for2d(N, H, [&](size_t n, size_t h) {
+            blob_copy_row_merge(src_ptr + n * N_src_stride + h * H_src_stride,
+                                dst_ptr + n * N_dst_stride + h * H_dst_stride,
+                                C_src_stride, C_dst_stride, W_dst_stride, C, W);
+        });
     } else {
-        for (int i = 0; i < N * C * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
+        std::memcpy(dst_ptr, src_ptr, N * C * H * W * sizeof(data_t));
     }
 }
 
@@ -184,18 +220,24 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
     if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW && C == 3 &&
         C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
         if (PRC == Precision::U8) {
-            blob_copy_5d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
-                                    C_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                    static_cast<int>(W));
+            parallel_for3d(N, D, H, [&](size_t n, size_t d, size_t h) {
+                blob_copy_5d_split_u8c3(
+                    reinterpret_cast<const uint8_t*>(src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride),
+                    reinterpret_cast<uint8_t*>(dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride),
+                    N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
+                    C_dst_stride, 1, 1, 1, static_cast<int>(W));
+            });
             return;
         }
 
         if (PRC == Precision::FP32) {
-            blob_copy_5d_split_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
-                                     C_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                     static_cast<int>(W));
+            parallel_for3d(N, D, H, [&](size_t n, size_t d, size_t h) {
+                blob_copy_5d_split_f32c3(
+                    reinterpret_cast<const float*>(src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride),
+                    reinterpret_cast<float*>(dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride),
+                    N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
+                    C_dst_stride, 1, 1, 1, static_cast<int>(W));
+            });
             return;
         }
     }
@@ -203,60 +245,42 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
     if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC && C == 3 &&
         C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
         if (PRC == Precision::U8) {
-            blob_copy_5d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
-                                    H_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                    static_cast<int>(W));
+            parallel_for3d(N, D, H, [&](size_t n, size_t d, size_t h) {
+                blob_copy_5d_merge_u8c3(
+                    reinterpret_cast<const uint8_t*>(src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride),
+                    reinterpret_cast<uint8_t*>(dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride),
+                    N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
+                    H_dst_stride, 1, 1, 1, static_cast<int>(W));
+            });
             return;
         }
 
         if (PRC == Precision::FP32) {
-            blob_copy_5d_merge_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
-                                     H_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                     static_cast<int>(W));
+            parallel_for3d(N, D, H, [&](size_t n, size_t d, size_t h) {
+                blob_copy_5d_merge_f32c3(
+                    reinterpret_cast<const float*>(src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride),
+                    reinterpret_cast<float*>(dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride),
+                    N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
+                    H_dst_stride, 1, 1, 1, static_cast<int>(W));
+            });
             return;
         }
     }
 #endif  // HAVE_SSE
     if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                for (int d = 0; d < D; d++) {
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride;
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    for (int h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (int w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            src_ptr_l_l += W_src_stride;
-                            dst_ptr_l++;
-                        }
-                    }
-                }
-            }
-        }
+        parallel_for3d(N, D, H, [&](size_t n, size_t d, size_t h) {
+            blob_copy_row_split(src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride,
+                                dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride,
+                                C_src_stride, W_src_stride, C_dst_stride, C, W);
+        });
     } else if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                for (int d = 0; d < D; d++) {
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c + d * D_dst_stride;
-                    for (int h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (int w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            dst_ptr_l += W_dst_stride;
-                            src_ptr_l_l++;
-                        }
-                    }
-                }
-            }
-        }
+        parallel_for3d(N, D, H, [&](size_t n, size_t d, size_t h) {
+            blob_copy_row_merge(src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride,
+                                dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride,
+                                C_src_stride, C_dst_stride, W_dst_stride, C, W);
+        });
     } else {
-        for (int i = 0; i < N * C * D * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
+        std::memcpy(dst_ptr, src_ptr, N * C * D * H * W * sizeof(data_t));
     }
 }
 
@@ -9,6 +9,7 @@
 
 #include "ie_compound_blob.h"
 
+#include <algorithm>
 #include <initializer_list>
 #include <memory>
 #include <utility>
@@ -192,6 +193,87 @@ void verifyI420BlobInput(const Blob::Ptr& y, const Blob::Ptr& u, const Blob::Ptr
     }
 }
 
+// the tensor descriptor of a batch element: YUV blobs are described by the Y plane
+TensorDesc getBlobTensorDesc(const Blob::Ptr& blob) {
+    if (auto nv12 = blob->as<NV12Blob>()) {
+        return nv12->y()->getTensorDesc();
+    }
+    if (auto i420 = blob->as<I420Blob>()) {
+        return i420->y()->getTensorDesc();
+    }
+    return blob->getTensorDesc();
+}
+
+TensorDesc verifyBatchedBlobInput(const std::vector<Blob::Ptr>& blobs) {
+    if (blobs.empty()) {
+        THROW_IE_EXCEPTION << "BatchedBlob cannot be created from empty vector of Blob objects";
+    }
+
+    // Cannot create a compound blob from nullptr Blob objects
+    if (std::any_of(blobs.begin(), blobs.end(), [](const Blob::Ptr& blob) {
+            return blob == nullptr;
+        })) {
+        THROW_IE_EXCEPTION << "Cannot create a compound blob from nullptr Blob objects";
+    }
+
+    // Only memory and YUV blobs can be batched, nested batches are not allowed
+    const auto isSupported = [](const Blob::Ptr& blob) {
+        return !blob->is<CompoundBlob>() || blob->is<NV12Blob>() || blob->is<I420Blob>();
+    };
+    if (!std::all_of(blobs.begin(), blobs.end(), isSupported)) {
+        THROW_IE_EXCEPTION << "BatchedBlob can be created from MemoryBlob, NV12Blob or I420Blob objects only";
+    }
+
+    const auto sameKind = [&](const Blob::Ptr& blob) {
+        return blob->is<NV12Blob>() == blobs.front()->is<NV12Blob>() &&
+               blob->is<I420Blob>() == blobs.front()->is<I420Blob>();
+    };
+    if (!std::all_of(blobs.begin(), blobs.end(), sameKind)) {
+        THROW_IE_EXCEPTION << "All blobs of BatchedBlob must have the same type";
+    }
+
+    const auto subBlobDesc = getBlobTensorDesc(blobs.front());
+    if (std::any_of(blobs.begin(), blobs.end(), [&subBlobDesc](const Blob::Ptr& blob) {
+            return getBlobTensorDesc(blob) != subBlobDesc;
+        })) {
+        THROW_IE_EXCEPTION << "All blobs of BatchedBlob must have equal tensor descriptors";
+    }
+
+    auto blobLayout = subBlobDesc.getLayout();
+    auto blobDims = subBlobDesc.getDims();
+    switch (blobLayout) {
+    case NCHW:
+    case NHWC:
+    case NCDHW:
+    case NDHWC:
+    case NC:
+    case CN:
+        if (blobDims[0] != 1) {
+            THROW_IE_EXCEPTION << "All blobs of BatchedBlob must have batch size 1, actual: " << blobDims[0];
+        }
+        blobDims[0] = blobs.size();
+        break;
+    case C:
+        blobLayout = NC;
+        blobDims.insert(blobDims.begin(), blobs.size());
+        break;
+    case CHW:
+        blobLayout = NCHW;
+        blobDims.insert(blobDims.begin(), blobs.size());
+        break;
+    default:
+        THROW_IE_EXCEPTION << "Unsupported layout of BatchedBlob elements: " << blobLayout
+                           << ", expected one of: NCHW, NHWC, NCDHW, NDHWC, NC, CN, C, CHW";
+    }
+
+    // YUV blobs keep the planar layout of NV12Blob and I420Blob
+    if (blobs.front()->is<CompoundBlob>()) {
+        blobLayout = NCHW;
+    }
+
+    return TensorDesc(subBlobDesc.getPrecision(), blobDims, blobLayout);
+}
+
 }  // anonymous namespace
 
 CompoundBlob::CompoundBlob(): Blob(TensorDesc(Precision::UNSPECIFIED, {}, Layout::ANY)) {}
@@ -412,4 +494,29 @@ Blob::Ptr I420Blob::createROI(const ROI& roi) const {
     return std::make_shared<I420Blob>(yRoiBlob, uRoiBlob, vRoiBlob);
 }
 
+BatchedBlob::BatchedBlob(const std::vector<Blob::Ptr>& blobs) {
+    // verify data is correct
+    tensorDesc = verifyBatchedBlobInput(blobs);
+    // set blobs
+    _blobs = blobs;
+}
+
+BatchedBlob::BatchedBlob(std::vector<Blob::Ptr>&& blobs) {
+    // verify data is correct
+    tensorDesc = verifyBatchedBlobInput(blobs);
+    // set blobs
+    _blobs = std::move(blobs);
+}
+
+Blob::Ptr BatchedBlob::createROI(const ROI& roi) const {
+    std::vector<Blob::Ptr> roiBlobs;
+    roiBlobs.reserve(_blobs.size());
+
+    for (const auto& blob : _blobs) {
+        roiBlobs.push_back(blob->createROI(roi));
+    }
+
+    return std::make_shared<BatchedBlob>(std::move(roiBlobs));
+}
+
 }  // namespace InferenceEngine
@@ -4,28 +4,158 @@
 
 #include <fstream>
 #include <map>
+#include <set>
+#include <sstream>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 #include <iostream>
 #include <sched.h>
 #include "ie_system_conf.h"
 #include "ie_parallel.hpp"
 #include "details/ie_exception.hpp"
+#include "os/lin/lin_system_conf.hpp"
+#include <algorithm>
 #include <numeric>
 
 
 namespace InferenceEngine {
 
+static std::string readLine(const std::string& path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+// Parses the kernel cpu list format, like "0-3,8,10-11"
+static std::vector<int> parseList(const std::string& list) {
+    std::vector<int> result;
+    std::stringstream ss(list);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        if (range.empty()) continue;
+        try {
+            auto delimeter = range.find('-');
+            int first = std::stoi(range.substr(0, delimeter));
+            int last = (delimeter == std::string::npos) ? first : std::stoi(range.substr(delimeter + 1));
+            for (int i = first; i <= last; i++) {
+                result.push_back(i);
+            }
+        } catch (const std::exception&) {
+            return {};
+        }
+    }
+    return result;
+}
+
+static int readInt(const std::string& path, int defaultValue) {
+    std::ifstream file(path);
+    int value = defaultValue;
+    if (!(file >> value)) {
+        return defaultValue;
+    }
+    return value;
+}
+
 struct CPU {
-    int _processors = 0;
+    struct Processor {
+        int id      = 0;
+        int package = 0;
+        int core    = 0;   // core id, unique inside the package only
+        int smt     = 0;   // position of the processor among the SMT siblings of its core
+        int l2      = -1;  // the first processor sharing the L2 cache, -1 if unknown
+        int l3      = -1;  // the first processor sharing the L3 cache, -1 if unknown
+        int numa    = 0;
+    };
+
+    std::vector<Processor> _processors;
+    std::vector<int>       _numaNodes;  // ordered by the distance, starting from the first node
     int _sockets    = 0;
     int _cores      = 0;
 
     CPU() {
+        if (!readSysfs()) {
+            readCpuInfo();
+        }
+        std::set<int> sockets;
+        std::set<std::pair<int, int>> cores;
+        for (auto&& processor : _processors) {
+            sockets.insert(processor.package);
+            cores.emplace(processor.package, processor.core);
+        }
+        _sockets = sockets.size();
+        _cores = cores.size();
+    }
+
+    bool readSysfs() {
+        const std::string cpuRoot = "/sys/devices/system/cpu/";
+        for (auto id : parseList(readLine(cpuRoot + "online"))) {
+            const std::string cpu = cpuRoot + "cpu" + std::to_string(id) + "/";
+            Processor processor;
+            processor.id = id;
+            processor.package = readInt(cpu + "topology/physical_package_id", 0);
+            processor.core = readInt(cpu + "topology/core_id", id);
+            const auto siblings = parseList(readLine(cpu + "topology/thread_siblings_list"));
+            const auto it = std::find(siblings.begin(), siblings.end(), id);
+            processor.smt = (it == siblings.end()) ? 0 : std::distance(siblings.begin(), it);
+            for (int index = 0;; index++) {
+                const std::string cache = cpu + "cache/index" + std::to_string(index) + "/";
+                const int level = readInt(cache + "level", -1);
+                if (level < 0) break;
+                if (readLine(cache + "type") == "Instruction") continue;
+                const auto shared = parseList(readLine(cache + "shared_cpu_list"));
+                if (shared.empty()) continue;
+                if (level == 2) processor.l2 = shared.front();
+                if (level == 3) processor.l3 = shared.front();
+            }
+            _processors.push_back(processor);
+        }
+        if (_processors.empty()) {
+            return false;
+        }
+
+        const std::string nodeRoot = "/sys/devices/system/node/";
+        const auto onlineNodes = parseList(readLine(nodeRoot + "online"));
+        std::map<int, std::vector<int>> distances;
+        for (auto node : onlineNodes) {
+            const std::string nodePath = nodeRoot + "node" + std::to_string(node) + "/";
+            const auto processors = parseList(readLine(nodePath + "cpulist"));
+            // skip memory only nodes
+            if (processors.empty()) continue;
+            for (auto id : processors) {
+                for (auto&& processor : _processors) {
+                    if (processor.id == id) processor.numa = node;
+                }
+            }
+            std::stringstream ss(readLine(nodePath + "distance"));
+            int distance = 0;
+            while (ss >> distance) {
+                distances[node].push_back(distance);
+            }
+            _numaNodes.push_back(node);
+        }
+
+        // Greedily order nodes by the distance, so neighbouring streams land on close nodes
+        for (size_t i = 1; i < _numaNodes.size(); i++) {
+            const auto& current = distances[_numaNodes[i - 1]];
+            const auto distanceTo = [&](int node) {
+                const auto position = std::distance(onlineNodes.begin(), std::find(onlineNodes.begin(), onlineNodes.end(), node));
+                return position < static_cast<std::ptrdiff_t>(current.size()) ? current[position] : 0;
+            };
+            const auto nearest = std::min_element(_numaNodes.begin() + i, _numaNodes.end(), [&](int a, int b) {
+                return distanceTo(a) < distanceTo(b);
+            });
+            std::iter_swap(_numaNodes.begin() + i, nearest);
+        }
+        return true;
+    }
+
+    void readCpuInfo() {
         std::ifstream cpuinfo("/proc/cpuinfo");
-        std::vector<int>    processors;
-        std::map<int, int>  sockets;
-        int socketId = 0;
+        Processor processor;
+        bool hasProcessor = false;
         while (!cpuinfo.eof()) {
             std::string line;
             std::getline(cpuinfo, line);
@@ -33,55 +163,98 @@ struct CPU {
             auto delimeter = line.find(':');
             auto key = line.substr(0, delimeter);
             auto value = line.substr(delimeter + 1);
-            if (0 == key.find("processor")) {
-                processors.emplace_back(std::stoi(value));
-            }
-            if (0 == key.find("physical id")) {
-                socketId = std::stoi(value);
-            }
-            if (0 == key.find("cpu cores")) {
-                sockets[socketId] = std::stoi(value);
+            try {
+                if (0 == key.find("processor")) {
+                    if (hasProcessor) _processors.push_back(processor);
+                    processor = {};
+                    processor.id = std::stoi(value);
+                    processor.core = processor.id;
+                    hasProcessor = true;
+                }
+                if (0 == key.find("physical id")) {
+                    processor.package = std::stoi(value);
+                }
+                if (0 == key.find("core id")) {
+                    processor.core = std::stoi(value);
+                }
+            } catch (const std::exception&) {
+                continue;
             }
         }
-        _processors = processors.size();
-        _sockets = sockets.size();
-        for (auto&& socket : sockets) {
-            _cores += socket.second;
-        }
-        if (_cores == 0) {
-            _cores = _processors;
+        if (hasProcessor) _processors.push_back(processor);
+
+        std::map<std::pair<int, int>, int> siblings;
+        for (auto&& processor : _processors) {
+            processor.smt = siblings[std::make_pair(processor.package, processor.core)]++;
         }
     }
+
+    int numaRank(int node) const {
+        const auto it = std::find(_numaNodes.begin(), _numaNodes.end(), node);
+        return std::distance(_numaNodes.begin(), it);
+    }
 };
 static CPU cpu;
+
 #if !((IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO))
 std::vector<int> getAvailableNUMANodes() {
+    if (!cpu._numaNodes.empty()) {
+        return cpu._numaNodes;
+    }
     std::vector<int> nodes((0 == cpu._sockets) ? 1 : cpu._sockets);
     std::iota(std::begin(nodes), std::end(nodes), 0);
     return nodes;
 }
 #endif
+
 int getNumberOfCPUCores() {
-    unsigned numberOfProcessors = cpu._processors;
-    unsigned totalNumberOfCpuCores = cpu._cores;
-    IE_ASSERT(totalNumberOfCpuCores != 0);
-    cpu_set_t usedCoreSet, currentCoreSet, currentCpuSet;
+    cpu_set_t currentCpuSet;
     CPU_ZERO(&currentCpuSet);
-    CPU_ZERO(&usedCoreSet);
-    CPU_ZERO(&currentCoreSet);
-
     sched_getaffinity(0, sizeof(currentCpuSet), &currentCpuSet);
 
-    for (int processorId = 0; processorId < numberOfProcessors; processorId++) {
-        if (CPU_ISSET(processorId, &currentCpuSet)) {
-            unsigned coreId = processorId % totalNumberOfCpuCores;
-            if (!CPU_ISSET(coreId, &usedCoreSet)) {
-                CPU_SET(coreId, &usedCoreSet);
-                CPU_SET(processorId, &currentCoreSet);
-            }
+    std::set<std::pair<int, int>> cores;
+    for (auto&& processor : cpu._processors) {
+        if (processor.id < CPU_SETSIZE && CPU_ISSET(processor.id, &currentCpuSet)) {
+            cores.emplace(processor.package, processor.core);
+        }
+    }
+    if (cores.empty()) {
+        IE_ASSERT(cpu._cores != 0);
+        return cpu._cores;
+    }
+    return cores.size();
+}
+
+std::vector<int> getProcessorsPlacementOrder(const cpu_set_t* mask, size_t size) {
+    std::vector<const CPU::Processor*> processors;
+    for (auto&& processor : cpu._processors) {
+        if (nullptr == mask || CPU_ISSET_S(processor.id, size, mask)) {
+            processors.push_back(&processor);
+        }
+    }
+    std::stable_sort(processors.begin(), processors.end(), [](const CPU::Processor* a, const CPU::Processor* b) {
+        return std::make_tuple(a->smt, cpu.numaRank(a->numa), a->package, a->l3, a->l2, a->core, a->id) <
+               std::make_tuple(b->smt, cpu.numaRank(b->numa), b->package, b->l3, b->l2, b->core, b->id);
+    });
+    std::vector<int> order;
+    order.reserve(processors.size());
+    for (auto processor : processors) {
+        order.push_back(processor->id);
+    }
+    return order;
+}
+
+std::vector<int> getNUMANodeProcessors(int numaNode) {
+    std::vector<int> processors;
+    if (cpu._numaNodes.empty()) {
+        return processors;
+    }
+    for (auto&& processor : cpu._processors) {
+        if (processor.numa == numaNode) {
+            processors.push_back(processor.id);
         }
     }
-    return CPU_COUNT(&currentCoreSet);
+    return processors;
 }
 
 }  // namespace InferenceEngine
@@ -0,0 +1,37 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Linux CPU topology helpers used for streams configuration and threads pinning
+ * @file lin_system_conf.hpp
+ */
+
+#pragma once
+
+#include <sched.h>
+#include <vector>
+
+namespace InferenceEngine {
+
+/**
+ * @brief      Orders logical processors of the mask for threads placement.
+ *             One processor per physical core goes first, cores of the same NUMA node, L3 and L2 cache
+ *             domains are placed next to each other, the SMT siblings follow in the same order.
+ *             So consecutive threads of a stream stay inside one cache domain.
+ *
+ * @param[in]  mask  The process affinity mask
+ * @param[in]  size  The mask size in bytes
+ * @return     Logical processor ids, empty if the topology is not available
+ */
+std::vector<int> getProcessorsPlacementOrder(const cpu_set_t* mask, size_t size);
+
+/**
+ * @brief      Returns logical processors of the NUMA node
+ *
+ * @param[in]  numaNode  The NUMA node id
+ * @return     Logical processor ids, empty if the node is unknown
+ */
+std::vector<int> getNUMANodeProcessors(int numaNode);
+
+}  // namespace InferenceEngine
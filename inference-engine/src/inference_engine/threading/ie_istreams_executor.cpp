@@ -12,7 +12,6 @@
 #include <string>
 #include <algorithm>
 #include <vector>
-#include <thread>
 
 
 namespace InferenceEngine {
@@ -47,9 +46,9 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
             if (value == CONFIG_VALUE(CPU_THROUGHPUT_NUMA)) {
                 _streams = getAvailableNUMANodes().size();
             } else if (value == CONFIG_VALUE(CPU_THROUGHPUT_AUTO)) {
-                const int sockets = getAvailableNUMANodes().size();
-                // bare minimum of streams (that evenly divides available number of core)
-                const int num_cores = sockets == 1 ? std::thread::hardware_concurrency() : getNumberOfCPUCores();
+                // bare minimum of streams (that evenly divides available number of physical cores),
+                // so SMT siblings do not end up in different streams competing for the same L1/L2 caches
+                const int num_cores = getNumberOfCPUCores();
                 if (0 == num_cores % 4)
                     _streams = std::max(4, num_cores / 4);
                 else if (0 == num_cores % 5)
@@ -128,10 +127,8 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) {
 
 IStreamsExecutor::Config IStreamsExecutor::Config::MakeDefaultMultiThreaded(const IStreamsExecutor::Config& initial) {
     const auto envThreads = parallel_get_env_threads();
-    const auto& numaNodes = getAvailableNUMANodes();
-    const auto numaNodesNum = numaNodes.size();
     auto streamExecutorConfig = initial;
-    const auto hwCores = streamExecutorConfig._streams > 1 && numaNodesNum == 1 ? parallel_get_max_threads() : getNumberOfCPUCores();
+    const auto hwCores = getNumberOfCPUCores();
     const auto threads = streamExecutorConfig._threads ? streamExecutorConfig._threads : (envThreads ? envThreads : hwCores);
     streamExecutorConfig._threadsPerStream = streamExecutorConfig._streams
                                             ? std::max(1, threads/streamExecutorConfig._streams)
@@ -8,6 +8,7 @@
 #include <cerrno>
 #include <utility>
 #include <tuple>
+#include <vector>
 
 
 #if !(defined(__APPLE__) || defined(_WIN32))
@@ -15,6 +16,10 @@
 #include <unistd.h>
 #endif
 
+#if defined(__linux__)
+#include "os/lin/lin_system_conf.hpp"
+#endif
+
 namespace InferenceEngine {
 #if !(defined(__APPLE__) || defined(_WIN32))
 std::tuple<CpuSet, int> GetProcessMask() {
@@ -46,7 +51,15 @@ bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSe
     if (procMask == nullptr)
         return false;
     const size_t size = CPU_ALLOC_SIZE(ncores);
-    const int num_cpus = CPU_COUNT_S(size, procMask.get());
+#if defined(__linux__)
+    // physical cores go first and cores sharing caches are adjacent, so threads of a stream share a cache domain
+    const auto order = getProcessorsPlacementOrder(procMask.get(), size);
+#else
+    const std::vector<int> order;
+#endif
+    const int num_cpus = order.empty() ? CPU_COUNT_S(size, procMask.get()) : static_cast<int>(order.size());
+    if (0 == num_cpus)
+        return false;
     thrIdx %= num_cpus;  // To limit unique number in [; num_cpus-1] range
     // Place threads with specified step
     int cpu_idx = 0;
@@ -56,12 +69,17 @@ bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSe
             cpu_idx = ++offset;
     }
 
-    // Find index of 'cpu_idx'-th bit that equals to 1
     int mapped_idx = 0;
-    while (cpu_idx >= 0) {
-        if (CPU_ISSET_S(mapped_idx, size, procMask.get()))
-            --cpu_idx;
-        mapped_idx++;
+    if (!order.empty()) {
+        mapped_idx = order[cpu_idx];
+    } else {
+        // Find index of 'cpu_idx'-th bit that equals to 1
+        mapped_idx = -1;
+        while (cpu_idx >= 0) {
+            mapped_idx++;
+            if (CPU_ISSET_S(mapped_idx, size, procMask.get()))
+                --cpu_idx;
+        }
     }
 
     CpuSet targetMask{CPU_ALLOC(ncores)};
@@ -83,8 +101,19 @@ bool PinCurrentThreadToSocket(int socket) {
     const size_t size = CPU_ALLOC_SIZE(ncpus);
     CPU_ZERO_S(size, targetMask.get());
 
-    for (int core = socket*cores_per_socket; core < (socket+1)*cores_per_socket; core++) {
-        CPU_SET_S(core, size, targetMask.get());
+#if defined(__linux__)
+    const auto numaProcessors = getNUMANodeProcessors(socket);
+#else
+    const std::vector<int> numaProcessors;
+#endif
+    if (!numaProcessors.empty()) {
+        for (auto processor : numaProcessors) {
+            CPU_SET_S(processor, size, targetMask.get());
+        }
+    } else {
+        for (int core = socket*cores_per_socket; core < (socket+1)*cores_per_socket; core++) {
+            CPU_SET_S(core, size, targetMask.get());
+        }
     }
     // respect the user-defined mask for the entire process
     CPU_AND_S(size, targetMask.get(), targetMask.get(), mask.get());
@@ -47,6 +47,7 @@
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
 #include "ie_legacy_itt.hpp"
+#include "ie_parallel.hpp"
 
 namespace InferenceEngine {
 namespace details {
@@ -747,160 +748,200 @@ void convertFunctionToICNNNetwork(const std::shared_ptr<const ::ngraph::Function
 
     bool keep_constants = keep_constant_inputs || ::ngraph::op::util::has_op_with_type<::ngraph::op::FakeQuantize>(graph);
 
-    // Create layers and output data
-    for (const auto &layer : nodes) {
-        if (isInternalLayer(layer, op_names, keep_constants)) continue;
-
-        // TODO: remove this rt info when all blobs will be inputs
-        auto &rt_info = layer->get_rt_info();
-        rt_info["keep_constants"] = std::make_shared<::ngraph::VariantWrapper<int64_t>> (keep_constants);
-
-        CNNLayerPtr cnnLayer = createCNNLayer(layer);
-
-        // Set originalLayersNames from FusedNames
-        std::string originalNames = ::ngraph::getFusedNames(layer);
-        if (!originalNames.empty()) {
-            cnnLayer->params[ExecGraphInfoSerialization::ORIGINAL_NAMES] = originalNames;
-        }
+    // Create layers. Each converter reads only its own node and the constants feeding it,
+    // so layers are created concurrently and attached to the network in the original order below.
+    std::vector<CNNLayerPtr> cnnLayers(nodes.size());
+    {
+        OV_ITT_SCOPED_TASK(itt::domains::IELegacy, "details::convertFunctionToICNNNetwork::createLayers");
+        std::mutex errorMutex;
+        std::exception_ptr error;
+        parallel_for(nodes.size(), [&](size_t i) {
+            const auto &layer = nodes[i];
+            try {
+                if (isInternalLayer(layer, op_names, keep_constants)) return;
+
+                // TODO: remove this rt info when all blobs will be inputs
+                auto &rt_info = layer->get_rt_info();
+                rt_info["keep_constants"] = std::make_shared<::ngraph::VariantWrapper<int64_t>> (keep_constants);
+
+                CNNLayerPtr cnnLayer = createCNNLayer(layer);
+
+                // Set originalLayersNames from FusedNames
+                std::string originalNames = ::ngraph::getFusedNames(layer);
+                if (!originalNames.empty()) {
+                    cnnLayer->params[ExecGraphInfoSerialization::ORIGINAL_NAMES] = originalNames;
+                }
 
-        std::string primitivesPriority = ::ngraph::getPrimitivesPriority(layer);
-        if (!primitivesPriority.empty()) {
-            cnnLayer->params["PrimitivesPriority"] = primitivesPriority;
-        }
+                std::string primitivesPriority = ::ngraph::getPrimitivesPriority(layer);
+                if (!primitivesPriority.empty()) {
+                    cnnLayer->params["PrimitivesPriority"] = primitivesPriority;
+                }
 
-        // Copy runtime info attributes from Nodes to CNNLayers if they have VariantWrapper<std::string> type
-        using VariantString = ::ngraph::VariantWrapper<std::string>;
-        for (const auto &rt : rt_info) {
-            if (auto str_attr = std::dynamic_pointer_cast<VariantString>(rt.second)) {
-                if (details::CaselessEq<std::string>()(rt.first, "affinity")) {
-                    cnnLayer->affinity = str_attr->get();
-                } else {
-                    cnnLayer->params[rt.first] = str_attr->get();
+                // Copy runtime info attributes from Nodes to CNNLayers if they have VariantWrapper<std::string> type
+                using VariantString = ::ngraph::VariantWrapper<std::string>;
+                for (const auto &rt : rt_info) {
+                    if (auto str_attr = std::dynamic_pointer_cast<VariantString>(rt.second)) {
+                        if (details::CaselessEq<std::string>()(rt.first, "affinity")) {
+                            cnnLayer->affinity = str_attr->get();
+                        } else {
+                            cnnLayer->params[rt.first] = str_attr->get();
+                        }
+                    }
                 }
+                cnnLayers[i] = cnnLayer;
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error)
+                    error = std::current_exception();
             }
-        }
+        });
+        if (error)
+            std::rethrow_exception(error);
+    }
 
-        size_t inputCount(0);
-        for (size_t i = 0; i < layer->get_input_size(); i++) {
-            const auto &constant = ngraph::as_type_ptr<ngraph::op::Constant>(layer->input(i).get_source_output().get_node_shared_ptr());
-            if (constant && isInternalConstLayer(constant, layer, keep_constants)) {
-                continue;
+    // Create output data
+    std::unordered_map<const ::ngraph::Node*, CNNLayerPtr> node_to_layer;
+    node_to_layer.reserve(nodes.size());
+    {
+        OV_ITT_SCOPED_TASK(itt::domains::IELegacy, "details::convertFunctionToICNNNetwork::createData");
+        for (size_t layerIdx = 0; layerIdx < nodes.size(); layerIdx++) {
+            const auto &layer = nodes[layerIdx];
+            const CNNLayerPtr &cnnLayer = cnnLayers[layerIdx];
+            if (!cnnLayer) continue;
+
+            size_t inputCount(0);
+            for (size_t i = 0; i < layer->get_input_size(); i++) {
+                const auto &constant = ngraph::as_type_ptr<ngraph::op::Constant>(layer->input(i).get_source_output().get_node_shared_ptr());
+                if (constant && isInternalConstLayer(constant, layer, keep_constants)) {
+                    continue;
+                }
+                inputCount++;
             }
-            inputCount++;
-        }
 
-        if (cnnLayer->type == "Memory" && cnnLayer->params["index"] == "1") {
-            inputCount = 0;
-        }
+            if (cnnLayer->type == "Memory" && cnnLayer->params["index"] == "1") {
+                inputCount = 0;
+            }
 
-        cnnLayer->insData.resize(inputCount);
-
-        for (size_t i = 0; i < layer->get_output_size(); i++) {
-            // Memory node with index = 1 has no inputs according to the specification.
-            // For proper conversion, we must cut off all the layers and data nodes above ReadValue,
-            // if they are connected only with this layer.
-            // Now MO generates only constants or constant sub-graphs as input to ReadValue op.
-            if (std::dynamic_pointer_cast<::ngraph::op::Constant>(layer)) {
-                bool all_to_read_value = !layer->output(i).get_target_inputs().empty();
-                for (const auto &output_input : layer->output(i).get_target_inputs()) {
-                    all_to_read_value
-                            &= dynamic_cast<ngraph::op::ReadValue *>(output_input.get_node()) != nullptr;
+            cnnLayer->insData.resize(inputCount);
+
+            for (size_t i = 0; i < layer->get_output_size(); i++) {
+                // Memory node with index = 1 has no inputs according to the specification.
+                // For proper conversion, we must cut off all the layers and data nodes above ReadValue,
+                // if they are connected only with this layer.
+                // Now MO generates only constants or constant sub-graphs as input to ReadValue op.
+                if (std::dynamic_pointer_cast<::ngraph::op::Constant>(layer)) {
+                    bool all_to_read_value = !layer->output(i).get_target_inputs().empty();
+                    for (const auto &output_input : layer->output(i).get_target_inputs()) {
+                        all_to_read_value
+                                &= dynamic_cast<ngraph::op::ReadValue *>(output_input.get_node()) != nullptr;
+                    }
+                    if (all_to_read_value)
+                        continue;
                 }
-                if (all_to_read_value)
-                    continue;
-            }
 
-            if (cnnLayer->type == "Memory" && cnnLayer->params["index"] == "0") {
-                cnnLayer->outData.clear();
-                continue;
-            }
-            std::string outName = layer->get_friendly_name();
-            if (layer->get_output_size() != 1) outName += "." + std::to_string(i);
-            DataPtr &ptr = cnnNetworkImpl->getData(outName.c_str());
-            SizeVector dims = layer->get_output_shape(i);
-            for (const auto &dim : dims) {
-                if (!dim)
-                    THROW_IE_EXCEPTION << cnnLayer->type << " layer " << cnnLayer->name
-                        << " has incorrect dimensions in the output data " << i;
-            }
-            if (!ptr && nGraphImpl && nGraphImpl->_data.find(outName) != nGraphImpl->_data.end()) {
-                ptr = nGraphImpl->_data.at(outName);
-                {
-                    const auto layout =
-                        dims.size() == ptr->getTensorDesc().getDims().size() ?
-                        ptr->getTensorDesc().getLayout() :
-                        TensorDesc::getLayoutByDims(dims);
-
-                    ptr->reshape(dims, layout);
+                if (cnnLayer->type == "Memory" && cnnLayer->params["index"] == "0") {
+                    cnnLayer->outData.clear();
+                    continue;
+                }
+                std::string outName = layer->get_friendly_name();
+                if (layer->get_output_size() != 1) outName += "." + std::to_string(i);
+                DataPtr &ptr = cnnNetworkImpl->getData(outName.c_str());
+                SizeVector dims = layer->get_output_shape(i);
+                for (const auto &dim : dims) {
+                    if (!dim)
+                        THROW_IE_EXCEPTION << cnnLayer->type << " layer " << cnnLayer->name
+                            << " has incorrect dimensions in the output data " << i;
+                }
+                if (!ptr && nGraphImpl && nGraphImpl->_data.find(outName) != nGraphImpl->_data.end()) {
+                    ptr = nGraphImpl->_data.at(outName);
+                    {
+                        const auto layout =
+                            dims.size() == ptr->getTensorDesc().getDims().size() ?
+                            ptr->getTensorDesc().getLayout() :
+                            TensorDesc::getLayoutByDims(dims);
+
+                        ptr->reshape(dims, layout);
+                    }
+                    cnnNetworkImpl->addData(outName.c_str(), ptr);
                 }
-                cnnNetworkImpl->addData(outName.c_str(), ptr);
-            }
 
-            if (!ptr) {
-                ptr.reset(new Data(outName,
-                                   {details::convertPrecision(layer->get_output_element_type(i)), dims,
-                                    TensorDesc::getLayoutByDims(dims)}));
-            }
+                if (!ptr) {
+                    ptr.reset(new Data(outName,
+                                       {details::convertPrecision(layer->get_output_element_type(i)), dims,
+                                        TensorDesc::getLayoutByDims(dims)}));
+                }
 
-            getCreatorLayer(ptr) = cnnLayer;
-            cnnLayer->outData.push_back(ptr);
-            if (std::dynamic_pointer_cast<::ngraph::op::Parameter>(layer)) {
-                keep_input_info(cnnNetworkImpl, ptr);
+                getCreatorLayer(ptr) = cnnLayer;
+                cnnLayer->outData.push_back(ptr);
+                if (std::dynamic_pointer_cast<::ngraph::op::Parameter>(layer)) {
+                    keep_input_info(cnnNetworkImpl, ptr);
+                }
             }
+            cnnNetworkImpl->addLayer(cnnLayer);
+            node_to_layer[layer.get()] = cnnLayer;
         }
-        cnnNetworkImpl->addLayer(cnnLayer);
     }
 
+    const auto findLayer = [&](const std::shared_ptr<::ngraph::Node> &node) -> CNNLayerPtr {
+        auto it = node_to_layer.find(node.get());
+        if (it != node_to_layer.end())
+            return it->second;
+        CNNLayerPtr cnnLayer;
+        if (cnnNetworkImpl->getLayerByName(node->get_friendly_name().c_str(), cnnLayer, nullptr) != OK)
+            THROW_IE_EXCEPTION << "Cannot find layer with name: " << node->get_friendly_name();
+        return cnnLayer;
+    };
+
     // Set input data
-    for (const auto &layer : graph->get_ordered_ops()) {
-        if (std::dynamic_pointer_cast<::ngraph::op::ReadValue>(layer))
-            continue;
-        if (std::dynamic_pointer_cast<::ngraph::op::Result>(layer)) {
-            IE_ASSERT(layer->inputs().size() == 1);
-            const auto &input = layer->input_value(0);
-            std::string outName = input.get_node_shared_ptr()->get_friendly_name();
-            if (input.get_node_shared_ptr()->get_output_size() != 1)
-                outName += "." + std::to_string(input.get_index());
-            cnnNetworkImpl->addOutput(outName);
-            continue;
-        }
+    // The connections do not depend on the traversal order, so the already collected nodes are reused
+    {
+        OV_ITT_SCOPED_TASK(itt::domains::IELegacy, "details::convertFunctionToICNNNetwork::connect");
+        for (const auto &layer : nodes) {
+            if (std::dynamic_pointer_cast<::ngraph::op::ReadValue>(layer))
+                continue;
+            if (std::dynamic_pointer_cast<::ngraph::op::Result>(layer)) {
+                IE_ASSERT(layer->inputs().size() == 1);
+                const auto &input = layer->input_value(0);
+                std::string outName = input.get_node_shared_ptr()->get_friendly_name();
+                if (input.get_node_shared_ptr()->get_output_size() != 1)
+                    outName += "." + std::to_string(input.get_index());
+                cnnNetworkImpl->addOutput(outName);
+                continue;
+            }
 
-        uint64_t count_of_skipped = 0;
-        for (size_t i = 0; i < layer->get_input_size(); i++) {
-            const auto &output_port = layer->input_value(i);
-            const auto &input = output_port.get_node_shared_ptr();
+            uint64_t count_of_skipped = 0;
+            for (size_t i = 0; i < layer->get_input_size(); i++) {
+                const auto &output_port = layer->input_value(i);
+                const auto &input = output_port.get_node_shared_ptr();
 
-            if (auto const_node = std::dynamic_pointer_cast<::ngraph::op::Constant>(input)) {
-                if (isInternalConstLayer(const_node, layer, keep_constants)) {
-                    count_of_skipped++;
-                    continue;
+                if (auto const_node = std::dynamic_pointer_cast<::ngraph::op::Constant>(input)) {
+                    if (isInternalConstLayer(const_node, layer, keep_constants)) {
+                        count_of_skipped++;
+                        continue;
+                    }
                 }
-            }
 
-            CNNLayerPtr prevCnnLayer;
-            StatusCode ret = cnnNetworkImpl->getLayerByName(input->get_friendly_name().c_str(), prevCnnLayer, nullptr);
-            if (ret != OK)
-                THROW_IE_EXCEPTION << "Cannot find layer with name: " << input->get_friendly_name();
-
-            CNNLayerPtr cnnLayer;
-            ret = cnnNetworkImpl->getLayerByName(layer->get_friendly_name().c_str(), cnnLayer, nullptr);
-            if (ret != OK) THROW_IE_EXCEPTION << "Cannot find layer with name: " << layer->get_friendly_name();
-
-            auto inIndex = layer->input(i).get_index();
-            if (cnnLayer->insData.size() <= (inIndex - count_of_skipped) ||
-                prevCnnLayer->outData.size() <= output_port.get_index() || count_of_skipped > inIndex)
-                THROW_IE_EXCEPTION << "Cannot create ICNNNetwork. Network structure is incorrect! "
-                                   << "Input port " << inIndex << " (max " << cnnLayer->insData.size() << ") of "
-                                   << cnnLayer->type << " layer " << cnnLayer->name
-                                   << " cannot be connected with output port " << output_port.get_index()
-                                   << " (max " << prevCnnLayer->outData.size() << ") of " << prevCnnLayer->type
-                                   << " layer " << prevCnnLayer->name;
-            cnnLayer->insData[inIndex - count_of_skipped] = prevCnnLayer->outData[output_port.get_index()];
-            getInputTo(prevCnnLayer->outData[output_port.get_index()])[cnnLayer->name] = cnnLayer;
+                CNNLayerPtr prevCnnLayer = findLayer(input);
+                CNNLayerPtr cnnLayer = findLayer(layer);
+
+                auto inIndex = layer->input(i).get_index();
+                if (cnnLayer->insData.size() <= (inIndex - count_of_skipped) ||
+                    prevCnnLayer->outData.size() <= output_port.get_index() || count_of_skipped > inIndex)
+                    THROW_IE_EXCEPTION << "Cannot create ICNNNetwork. Network structure is incorrect! "
+                                       << "Input port " << inIndex << " (max " << cnnLayer->insData.size() << ") of "
+                                       << cnnLayer->type << " layer " << cnnLayer->name
+                                       << " cannot be connected with output port " << output_port.get_index()
+                                       << " (max " << prevCnnLayer->outData.size() << ") of " << prevCnnLayer->type
+                                       << " layer " << prevCnnLayer->name;
+                cnnLayer->insData[inIndex - count_of_skipped] = prevCnnLayer->outData[output_port.get_index()];
+                getInputTo(prevCnnLayer->outData[output_port.get_index()])[cnnLayer->name] = cnnLayer;
+            }
         }
     }
 
     // check all input ports are occupied
+    std::vector<CNNLayerPtr> parsedLayers;
+    parsedLayers.reserve(cnnNetworkImpl->allLayers().size());
     for (const auto &kvp : cnnNetworkImpl->allLayers()) {
         const CNNLayer::Ptr &layer = kvp.second;
         size_t inSize = layer->insData.size();
@@ -914,10 +955,28 @@ void convertFunctionToICNNNetwork(const std::shared_ptr<const ::ngraph::Function
 
         // execution ngraph is fake graph and should not be validated
         if (layer->params.count(ExecGraphInfoSerialization::PERF_COUNTER) == 0) {
-            layer->parseParams();
+            parsedLayers.push_back(layer);
         }
     }
 
+    // Layer parameters are validated independently
+    {
+        OV_ITT_SCOPED_TASK(itt::domains::IELegacy, "details::convertFunctionToICNNNetwork::parseParams");
+        std::mutex errorMutex;
+        std::exception_ptr error;
+        parallel_for(parsedLayers.size(), [&](size_t i) {
+            try {
+                parsedLayers[i]->parseParams();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+        });
+        if (error)
+            std::rethrow_exception(error);
+    }
+
     if (!cnnNetworkImpl) THROW_IE_EXCEPTION << "Cannot convert nGraph function to CNNNetworkImpl!";
 
     // update input preprocessing info
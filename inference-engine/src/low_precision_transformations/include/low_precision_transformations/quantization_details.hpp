@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <ie_layers.h>
@@ -76,6 +78,33 @@ private:
     static std::vector<float> getBlobValue(const CNNLayerPtr& constantLayer);
 };
 
+/**
+* @brief Memoizes QuantizationDetails::getDetails results of the calling thread while the object exists.
+* The details are recomputed when the constant inputs, the levels or the output of the layer change.
+*/
+class INFERENCE_ENGINE_API_CLASS(QuantizationDetailsCache) {
+public:
+    QuantizationDetailsCache();
+    ~QuantizationDetailsCache();
+
+    QuantizationDetailsCache(const QuantizationDetailsCache&) = delete;
+    QuantizationDetailsCache& operator=(const QuantizationDetailsCache&) = delete;
+
+    struct Entry {
+        // the blobs are kept alive, so that a new blob can not get the address of a cached one
+        std::vector<Blob::Ptr> intervals;
+        std::string levels;
+        SizeVector outputDims;
+        bool isOnConstWeights;
+        std::shared_ptr<QuantizationDetails> details;
+    };
+
+    std::unordered_map<const CNNLayer*, Entry> entries;
+
+private:
+    QuantizationDetailsCache* previous;
+};
+
 inline std::ostream &operator << (std::ostream &os, const QuantizationDetails& value) {
     os << "levels: " << value.levels <<
         ", input 1/" << value.inputIntervalsCount << ": [" << value.getInputLowValue(0) << " : " << value.getInputHighValue(0) << "], " <<
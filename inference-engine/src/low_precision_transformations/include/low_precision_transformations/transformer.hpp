@@ -5,6 +5,7 @@
 #pragma once
 
 #include <algorithm>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -113,9 +114,26 @@ public:
     bool isQuantized(const CNNLayer& layer) const noexcept override;
     bool isPrecisionPreserved(const CNNLayer& layer) const noexcept override;
 
+    /**
+     * @brief Time spent by a transformation in the last transform call
+     */
+    struct TransformationStatistics {
+        size_t count = 0;  // number of the layers the transformation was called for
+        std::chrono::nanoseconds time{0};
+    };
+
+    /**
+     * @brief Returns the statistics of the last transform call by "<step>:<layer type>" of the transformations,
+     * where the step is one of branchSpecific, fakeQuantize, transformation or cleanup
+     */
+    const std::map<std::string, TransformationStatistics>& getStatistics() const noexcept;
+
 private:
     static void renameLayersByType(const std::vector<CNNLayerPtr>& layers, const std::string& type);
+    void transformLayer(TransformationContext& context, CNNLayer& layer, const LayerTransformationPtr& transformation,
+                        const std::string& step);
     LowPrecisionTransformations transformations;
+    std::map<std::string, TransformationStatistics> statistics;
 };
 
 IE_SUPPRESS_DEPRECATED_END
@@ -5,8 +5,11 @@
 #include "low_precision_transformations/blob_transformation.hpp"
 #include "low_precision_transformations/network_helper.hpp"
 #include "details/ie_cnn_network_tools.h"
+#include <ie_parallel.hpp>
 
 #include <algorithm>
+#include <exception>
+#include <unordered_set>
 #include <vector>
 
 
@@ -16,6 +19,7 @@ using namespace InferenceEngine::details;
 void BlobTransformation::transform(ICNNNetwork& network, bool transformWithFakeQuantizeOnWeights) const {
     const std::vector<CNNLayerPtr> layers = CNNNetSortTopologically(network);
 
+    std::vector<CNNLayerPtr> weightableLayers;
     for (const CNNLayerPtr& layer : layers) {
         if (layer->insData.size() < 2) {
             continue;
@@ -30,28 +34,66 @@ void BlobTransformation::transform(ICNNNetwork& network, bool transformWithFakeQ
             continue;
         }
 
-        WeightableLayer* weightableLayer = dynamic_cast<WeightableLayer*>(layer.get());
-        if (weightableLayer == nullptr) {
+        if (dynamic_cast<WeightableLayer*>(layer.get()) == nullptr) {
             continue;
         }
+        weightableLayers.push_back(layer);
+    }
 
-        const Blob::Ptr weightsBlob = CNNNetworkHelper::getWeights(*layer, false);
-        if (weightsBlob != nullptr) {
-            weightableLayer->blobs["weights"] = weightsBlob;
-            weightableLayer->_weights = weightsBlob;
+    // the weights on FakeQuantize are requantized, which is the most of the work, so the blobs are got in parallel
+    // and the network is modified sequentially afterwards
+    std::vector<Blob::Ptr> weightsBlobs(weightableLayers.size());
+    std::vector<Blob::Ptr> biasesBlobs(weightableLayers.size());
+    std::vector<std::exception_ptr> exceptions(weightableLayers.size());
+    parallel_for(weightableLayers.size(), [&](size_t i) {
+        try {
+            const CNNLayer& layer = *weightableLayers[i];
+            weightsBlobs[i] = CNNNetworkHelper::getWeights(layer, false);
+            if (layer.insData.size() >= 3) {
+                biasesBlobs[i] = CNNNetworkHelper::getBiases(layer);
+            }
+        } catch (...) {
+            exceptions[i] = std::current_exception();
         }
+    });
+    for (const std::exception_ptr& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
 
-        if (layer->insData.size() >= 3) {
-            const Blob::Ptr biasesBlob = CNNNetworkHelper::getBiases(*layer);
-            if (biasesBlob != nullptr) {
-                weightableLayer->blobs["biases"] = biasesBlob;
-                weightableLayer->_biases = biasesBlob;
-            }
+    // the parents are got before any of them is removed: removal of weights shared by several layers
+    // disconnects all of them
+    std::vector<CNNLayerPtr> weightsLayers(weightableLayers.size());
+    std::vector<CNNLayerPtr> biasesLayers(weightableLayers.size());
+    for (size_t i = 0; i < weightableLayers.size(); ++i) {
+        const CNNLayer& layer = *weightableLayers[i];
+        weightsLayers[i] = CNNNetworkHelper::getParent(layer, 1);
+        if (layer.insData.size() >= 3) {
+            biasesLayers[i] = CNNNetworkHelper::getParent(layer, 2);
+        }
+    }
 
-            CNNLayerPtr biasesLayer = CNNNetworkHelper::getParent(*layer, 2);
-            CNNNetworkHelper::removeLayer(network, biasesLayer);
+    std::unordered_set<const CNNLayer*> removedLayers;
+    for (size_t i = 0; i < weightableLayers.size(); ++i) {
+        WeightableLayer* weightableLayer = dynamic_cast<WeightableLayer*>(weightableLayers[i].get());
+
+        if (weightsBlobs[i] != nullptr) {
+            weightableLayer->blobs["weights"] = weightsBlobs[i];
+            weightableLayer->_weights = weightsBlobs[i];
+        }
+
+        if (biasesBlobs[i] != nullptr) {
+            weightableLayer->blobs["biases"] = biasesBlobs[i];
+            weightableLayer->_biases = biasesBlobs[i];
         }
 
-        CNNNetworkHelper::removeLayer(network, weightsLayer);
+        if ((biasesLayers[i] != nullptr) && removedLayers.insert(biasesLayers[i].get()).second) {
+            CNNNetworkHelper::removeLayer(network, biasesLayers[i]);
+        }
+
+        if (removedLayers.insert(weightsLayers[i].get()).second) {
+            CNNNetworkHelper::removeLayer(network, weightsLayers[i]);
+        }
     }
 }
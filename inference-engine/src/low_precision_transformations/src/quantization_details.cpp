@@ -189,21 +189,24 @@ void QuantizationDetails::getOutputIntervals(
     outputIntervalsCount = outputLowValues.size();
 }
 
-QuantizationDetails QuantizationDetails::getDetails(const CNNLayer& quantize) {
+namespace {
+
+thread_local QuantizationDetailsCache* currentCache = nullptr;
+
+QuantizationDetails createDetails(const CNNLayer& quantize, const bool isOnConstWeights) {
     std::vector<float> inputLowValues;
     std::vector<float> inputHighValues;
     size_t inputIntervalsCount;
-    getInputIntervals(quantize, inputLowValues, inputHighValues, inputIntervalsCount);
+    QuantizationDetails::getInputIntervals(quantize, inputLowValues, inputHighValues, inputIntervalsCount);
 
     std::vector<float> outputLowValues;
     std::vector<float> outputHighValues;
     size_t outputIntervalsCount;
-    getOutputIntervals(quantize, outputLowValues, outputHighValues, outputIntervalsCount);
+    QuantizationDetails::getOutputIntervals(quantize, outputLowValues, outputHighValues, outputIntervalsCount);
 
-    const size_t outputChannelsCount = CNNNetworkHelper::getOutputChannelsCount(
-        quantize,
-        CNNNetworkHelper::onWeights(quantize) && CNNNetworkHelper::onConstWeightsPath(quantize));
-    if (!outputLayoutIsSupported(quantize)) {
+    const size_t outputChannelsCount = CNNNetworkHelper::getOutputChannelsCount(quantize, isOnConstWeights);
+    // the same check as outputLayoutIsSupported does, without getting the intervals once again
+    if ((outputIntervalsCount != 1ul) && (outputIntervalsCount != outputChannelsCount)) {
         THROW_IE_LPT_EXCEPTION(quantize) << "Expected output channels count " << outputIntervalsCount << " but found " << outputChannelsCount;
     }
 
@@ -222,6 +225,65 @@ QuantizationDetails QuantizationDetails::getDetails(const CNNLayer& quantize) {
         outputChannelsCount);
 }
 
+// returns the blobs of the interval constants or an empty vector if the layer is malformed
+std::vector<Blob::Ptr> getIntervalBlobs(const CNNLayer& quantize) {
+    std::vector<Blob::Ptr> blobs;
+    if (quantize.insData.size() != 5) {
+        return blobs;
+    }
+    for (size_t i = 1; i < 5; ++i) {
+        const DataPtr data = quantize.insData[i].lock();
+        const CNNLayerPtr constLayer = data == nullptr ? nullptr : getCreatorLayer(data).lock();
+        if ((constLayer == nullptr) || (constLayer->blobs.size() != 1)) {
+            return {};
+        }
+        blobs.push_back(constLayer->blobs.begin()->second);
+    }
+    return blobs;
+}
+
+}  // namespace
+
+QuantizationDetailsCache::QuantizationDetailsCache() : previous(currentCache) {
+    currentCache = this;
+}
+
+QuantizationDetailsCache::~QuantizationDetailsCache() {
+    currentCache = previous;
+}
+
+QuantizationDetails QuantizationDetails::getDetails(const CNNLayer& quantize) {
+    const bool isOnConstWeights =
+        CNNNetworkHelper::onWeights(quantize) && CNNNetworkHelper::onConstWeightsPath(quantize);
+    if ((currentCache == nullptr) || quantize.outData.empty() || !quantize.CheckParamPresence("levels")) {
+        return createDetails(quantize, isOnConstWeights);
+    }
+
+    std::vector<Blob::Ptr> intervals = getIntervalBlobs(quantize);
+    if (intervals.empty()) {
+        return createDetails(quantize, isOnConstWeights);
+    }
+
+    const std::string& levels = quantize.params.at("levels");
+    const SizeVector& outputDims = quantize.outData[0]->getDims();
+    auto it = currentCache->entries.find(&quantize);
+    if ((it != currentCache->entries.end()) &&
+        (it->second.intervals == intervals) &&
+        (it->second.levels == levels) &&
+        (it->second.outputDims == outputDims) &&
+        (it->second.isOnConstWeights == isOnConstWeights)) {
+        return *it->second.details;
+    }
+
+    QuantizationDetailsCache::Entry& entry = currentCache->entries[&quantize];
+    entry.details = std::make_shared<QuantizationDetails>(createDetails(quantize, isOnConstWeights));
+    entry.intervals = std::move(intervals);
+    entry.levels = levels;
+    entry.outputDims = outputDims;
+    entry.isOnConstWeights = isOnConstWeights;
+    return *entry.details;
+}
+
 bool QuantizationDetails::hasNegativeOutput() const {
     for (const float value : outputLowValues) {
         if (value < 0.f) {
@@ -46,6 +46,9 @@
 // uncomment to display precision info during low precision transformations
 // #define DISPLAY_PECISION
 
+// uncomment to display the time spent by every transformation
+// #define DISPLAY_TIMING
+
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
@@ -291,6 +294,7 @@ void LowPrecisionTransformer::rename(ICNNNetwork& network) const {
 
 void LowPrecisionTransformer::transform(ICNNNetwork& network) {
     OV_ITT_SCOPED_TASK(itt::domains::LPT, "LowPrecisionTransformer::transform");
+    statistics.clear();
 
 #ifdef LPT_ORIGINAL_MODEL_PATH
     ResponseDesc originalModelResponse;
@@ -323,6 +327,9 @@ void LowPrecisionTransformer::transform(ICNNNetwork& network) {
     transformations.setParamsManager(this);
     transformations.setLayerTransformationsManager(this);
 
+    // quantization details of the same FakeQuantize layers are requested by many transformations
+    QuantizationDetailsCache quantizationDetailsCache;
+
     TransformationContext context(network);
 
     // TODO: branch specific transformations execution
@@ -338,7 +345,7 @@ void LowPrecisionTransformer::transform(ICNNNetwork& network) {
         if (it == transformations.branchSpecificTransformations.end()) {
             continue;
         }
-        it->second->transform(context, *layer);
+        transformLayer(context, *layer, it->second, "branchSpecific");
     }
 
     // Step #1: FakeQuantize layer transformation execution
@@ -353,7 +360,7 @@ void LowPrecisionTransformer::transform(ICNNNetwork& network) {
         }
 
         if (CaselessEq<std::string>()(layer->type, "FakeQuantize")) {
-            fqTransformation->transform(context, *layer);
+            transformLayer(context, *layer, fqTransformation, "fakeQuantize");
         }
     }
 
@@ -370,7 +377,7 @@ void LowPrecisionTransformer::transform(ICNNNetwork& network) {
         std::transform(type.begin(), type.end(), type.begin(), ::tolower);
         const auto it = transformations.transformations.find(type);
         if (it != transformations.transformations.end()) {
-            it->second->transform(context, *layer);
+            transformLayer(context, *layer, it->second, "transformation");
             transformed = true;
         }
 
@@ -410,10 +417,18 @@ void LowPrecisionTransformer::transform(ICNNNetwork& network) {
         std::transform(type.begin(), type.end(), type.begin(), ::tolower);
         const auto it = transformations.cleanupTransformations.find(type);
         if (it != transformations.cleanupTransformations.end()) {
-            it->second->transform(context, *layer);
+            transformLayer(context, *layer, it->second, "cleanup");
         }
     }
 
+#ifdef DISPLAY_TIMING
+    for (const auto& it : statistics) {
+        std::cout << it.first << ": " << it.second.count << " layers, "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(it.second.time).count() << " us"
+                  << std::endl;
+    }
+#endif
+
 #ifdef LPT_TRANSFORMED_MODEL_PATH
     ResponseDesc transformedModelResponse;
     network.serialize(
@@ -426,6 +441,24 @@ void LowPrecisionTransformer::transform(ICNNNetwork& network) {
 #endif
 }
 
+void LowPrecisionTransformer::transformLayer(TransformationContext& context, CNNLayer& layer,
+                                             const LayerTransformationPtr& transformation, const std::string& step) {
+    // the layer can be removed by the transformation
+    std::string type = layer.type;
+    std::transform(type.begin(), type.end(), type.begin(), ::tolower);
+
+    const auto start = std::chrono::steady_clock::now();
+    transformation->transform(context, layer);
+    TransformationStatistics& transformationStatistics = statistics[step + ":" + type];
+    transformationStatistics.time += std::chrono::steady_clock::now() - start;
+    ++transformationStatistics.count;
+}
+
+const std::map<std::string, LowPrecisionTransformer::TransformationStatistics>&
+LowPrecisionTransformer::getStatistics() const noexcept {
+    return statistics;
+}
+
 std::vector<Precision> LowPrecisionTransformer::getPrecisionsOnActivations(const std::string& layerType) const noexcept {
     std::string type = layerType;
     std::transform(type.begin(), type.end(), type.begin(), ::tolower);
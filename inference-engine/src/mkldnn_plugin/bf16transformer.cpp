@@ -8,10 +8,17 @@
 #include <fstream>
 #include <utility>
 #include <set>
+#include <map>
 #include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
 #include "details/ie_cnn_network_tools.h"
 #include "ie_util_internal.hpp"
 #include "ngraph/type/bfloat16.hpp"
+#include "mkldnn_graph.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -229,6 +236,175 @@ bool BF16Transformer::tryToMarkFP32(InferenceEngine::DataPtr data, const std::se
     return marked;
 }
 
+namespace {
+
+// each round of the calibration compiles the network once more, so their number is limited
+const size_t maxCalibrationRounds = 10;
+
+// sums of the squared differences from the FP32 outputs and of the squared FP32 outputs of a node
+struct CalibrationError {
+    double diff = 0.0;
+    double ref = 0.0;
+
+    float relative() const {
+        if (ref > 0.0)
+            return static_cast<float>(std::sqrt(diff / ref));
+        return diff > 0.0 ? std::numeric_limits<float>::max() : 0.0f;
+    }
+};
+
+std::vector<BlobMap> readCalibrationSamples(const std::string &path, const InputsDataMap &inputs) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+        THROW_IE_EXCEPTION << "Cannot open the bfloat16 calibration data file " << path;
+    size_t fileSize = static_cast<size_t>(file.tellg());
+    file.seekg(0);
+
+    size_t sampleSize = 0;
+    for (auto &input : inputs) {
+        auto dims = input.second->getTensorDesc().getDims();
+        sampleSize += std::accumulate(dims.begin(), dims.end(), sizeof(float), std::multiplies<size_t>());
+    }
+    if (sampleSize == 0 || fileSize == 0 || fileSize % sampleSize != 0)
+        THROW_IE_EXCEPTION << "The size of the bfloat16 calibration data file " << path << " (" << fileSize
+                           << " bytes) is not a multiple of the size of the network inputs (" << sampleSize
+                           << " bytes)";
+
+    // the inputs are stored in the order of their names, as InputsDataMap sorts them
+    std::vector<BlobMap> samples(fileSize / sampleSize);
+    for (auto &sample : samples) {
+        for (auto &input : inputs) {
+            auto dims = input.second->getTensorDesc().getDims();
+            auto blob = make_shared_blob<float>(TensorDesc(Precision::FP32, dims, TensorDesc::getLayoutByDims(dims)));
+            blob->allocate();
+            file.read(blob->buffer().as<char *>(), blob->byteSize());
+            sample[input.first] = blob;
+        }
+    }
+    if (!file)
+        THROW_IE_EXCEPTION << "Cannot read the bfloat16 calibration data file " << path;
+    return samples;
+}
+
+// copies the first output of the node to a plain FP32 buffer, leaves it empty for non floating point outputs
+void readNodeOutput(const MKLDNNNodePtr &node, const mkldnn::engine &engine, std::vector<float> &output) {
+    output.clear();
+    const MKLDNNMemory *memory = nullptr;
+    if (!node->getChildEdges().empty())
+        memory = &node->getChildEdgeAt(0)->getMemory();
+    else if (node->getType() == Output && !node->getParentEdges().empty())
+        memory = &node->getParentEdgeAt(0)->getMemory();
+
+    if (memory == nullptr || memory->GetElementsCount() == 0
+        || (memory->GetDataType() != mkldnn::memory::f32 && memory->GetDataType() != mkldnn::memory::bf16))
+        return;
+
+    auto dims = memory->GetDims();
+    MKLDNNMemory plain(engine);
+    plain.Create(dims, mkldnn::memory::f32, MKLDNNMemory::GetPlainFormat(dims));
+    plain.SetData(*memory, false);
+    const float *data = static_cast<const float *>(plain.GetData());
+    output.assign(data, data + plain.GetElementsCount());
+}
+
+// runs the graph node by node to read every output before the memory is reused by the following nodes
+void inferSample(MKLDNNGraph &graph, const BlobMap &sample,
+                 const std::function<void(const MKLDNNNodePtr &, const std::vector<float> &)> &onOutput) {
+    for (auto &input : sample)
+        graph.PushInputData(input.first, input.second);
+
+    mkldnn::stream stream = mkldnn::stream(mkldnn::stream::kind::eager);
+    std::vector<float> output;
+    for (auto &node : graph.GetNodes()) {
+        if (node->isConstant())
+            continue;
+        node->execute(stream);
+        readNodeOutput(node, graph.getEngine(), output);
+        if (!output.empty())
+            onOutput(node, output);
+    }
+}
+
+}  // namespace
+
+void BF16Transformer::calibrateToFloat(InferenceEngine::CNNNetwork &network,
+                                       const std::string &samplesPath,
+                                       float threshold,
+                                       const std::function<std::shared_ptr<MKLDNNGraph>(CNNNetwork &)> &createGraph) {
+    std::vector<BlobMap> samples = readCalibrationSamples(samplesPath, network.getInputsInfo());
+
+    CNNNetwork reference(cloneNet(static_cast<ICNNNetwork &>(network)));
+    convertToFloat(reference);
+    auto referenceGraph = createGraph(reference);
+
+    for (size_t calibrationRound = 0; calibrationRound < maxCalibrationRounds; calibrationRound++) {
+        auto graph = createGraph(network);
+
+        // the nodes are matched by names, the ones existing in one graph only (e.g. reorders) are not measured
+        std::map<std::string, CalibrationError> errors;
+        std::map<std::string, std::vector<float>> referenceOutputs;
+        for (auto &sample : samples) {
+            inferSample(*referenceGraph, sample, [&](const MKLDNNNodePtr &node, const std::vector<float> &output) {
+                referenceOutputs[node->getName()] = output;
+            });
+            inferSample(*graph, sample, [&](const MKLDNNNodePtr &node, const std::vector<float> &output) {
+                auto ref = referenceOutputs.find(node->getName());
+                if (ref == referenceOutputs.end() || ref->second.size() != output.size())
+                    return;
+                auto &error = errors[node->getName()];
+                for (size_t i = 0; i < output.size(); i++) {
+                    double diff = static_cast<double>(output[i]) - ref->second[i];
+                    error.diff += diff * diff;
+                    error.ref += static_cast<double>(ref->second[i]) * ref->second[i];
+                }
+            });
+        }
+
+        std::map<std::string, CNNLayerPtr> layers;
+        for (auto &layer : CNNNetSortTopologically(network))
+            layers[layer->name] = layer;
+
+        // the nodes which are not measured inherit the largest error of their inputs
+        std::map<std::string, float> nodeErrors;
+        std::vector<std::pair<float, CNNLayerPtr>> candidates;
+        bool outputsWithinThreshold = true;
+        for (auto &node : graph->GetNodes()) {
+            float inputError = 0.0f;
+            for (size_t i = 0; i < node->getParentEdges().size(); i++)
+                inputError = std::max(inputError, nodeErrors[node->getParentEdgeAt(i)->getParent()->getName()]);
+
+            auto error = errors.find(node->getName());
+            float outputError = error != errors.end() ? error->second.relative() : inputError;
+            nodeErrors[node->getName()] = outputError;
+
+            if (node->getType() == Output && outputError > threshold)
+                outputsWithinThreshold = false;
+
+            auto layer = layers.find(node->getName());
+            if (layer != layers.end() && _initbf16.find(layer->second->type) != _initbf16.end()
+                && layer->second->insData[0].lock()->getPrecision() == Precision::BF16)
+                candidates.emplace_back(outputError - inputError, layer->second);
+        }
+
+        std::sort(candidates.begin(), candidates.end(),
+                  [](const std::pair<float, CNNLayerPtr> &a, const std::pair<float, CNNLayerPtr> &b) {
+                      return a.first > b.first;
+                  });
+        bool marked = false;
+        for (auto &candidate : candidates) {
+            if (candidate.first > threshold || (!marked && !outputsWithinThreshold)) {
+                // the other _initbf16 consumers of the same tensor get FP32 input as well
+                candidate.second->insData[0].lock()->setPrecision(Precision::FP32);
+                marked = true;
+            }
+        }
+        if (!marked)
+            break;
+
+        optimizeToFloat(network);
+    }
+}
+
 InferenceEngine::MemoryBlob::Ptr BF16Transformer::convertBF16ToFloat(InferenceEngine::MemoryBlob::Ptr tweights) {
     TensorDesc td(Precision::FP32, tweights->getTensorDesc().getDims(), tweights->getTensorDesc().getLayout());
     MemoryBlob::Ptr weightsFP32 = make_shared_blob<float>(td);
@@ -5,12 +5,16 @@
 #pragma once
 
 #include <details/caseless.hpp>
+#include <functional>
+#include <memory>
 #include <string>
 #include <set>
 #include "inference_engine.hpp"
 
 namespace MKLDNNPlugin {
 
+class MKLDNNGraph;
+
 class BF16Transformer {
     const InferenceEngine::details::caseless_set<std::string> _initbf16 =
         { "convolution", "fullyconnected", "innerproduct" };
@@ -60,6 +64,23 @@ public:
     */
     void convertToBFloat16(InferenceEngine::CNNNetwork &network);
 
+    /**
+     * Keeps in FP32 the layers which are too sensitive to run in bfloat16, starting from the network marked by
+     * convertToBFloat16. The samples from samplesPath are inferred by the graphs of the network in FP32 and
+     * in the current mixed precision, and the relative RMS error of every node output is measured.
+     *
+     * Algo:
+     * 1. _initbf16 layers with BF16 input increasing the error by more than threshold get FP32 input
+     * 2. if there are none but the error of a network output exceeds threshold, the one increasing
+     * the error the most gets FP32 input
+     * 3. optimizeToFloat propagates the marks and the next round starts until nothing is marked
+     */
+    void calibrateToFloat(InferenceEngine::CNNNetwork &network,
+                          const std::string &samplesPath,
+                          float threshold,
+                          const std::function<std::shared_ptr<MKLDNNGraph>(InferenceEngine::CNNNetwork &)>
+                              &createGraph);
+
     InferenceEngine::MemoryBlob::Ptr convertBF16ToFloat(InferenceEngine::MemoryBlob::Ptr);
 };
 
@@ -81,6 +81,43 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_ENFORCE_BF16
                     << ". Expected only YES/NO";
             }
+        } else if (key == PluginConfigParams::KEY_CPU_WEIGHTS_CACHE_DIR) {
+            // empty string means that the weights are not shared with other processes
+            weightsCacheDir = val;
+        } else if (key == PluginConfigParams::KEY_CPU_PROFILING_REPORT) {
+            // empty string means that only the average times are collected
+            profilingReport = val;
+        } else if (key == PluginConfigParams::KEY_CPU_BF16_CALIBRATION_DATA) {
+            // empty string means that the bfloat16 layers are selected by their types only
+            bf16CalibrationData = val;
+        } else if (key == PluginConfigParams::KEY_CPU_BF16_CALIBRATION_THRESHOLD) {
+            float threshold = 0.0f;
+            try {
+                threshold = std::stof(val);
+            } catch (const std::exception&) {
+            }
+            if (!(threshold > 0.0f))
+                THROW_IE_EXCEPTION << "Wrong value for property key "
+                                   << PluginConfigParams::KEY_CPU_BF16_CALIBRATION_THRESHOLD
+                                   << ". Expected a positive number";
+            bf16CalibrationThreshold = threshold;
+        } else if (key == PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION) {
+            if (val == PluginConfigParams::WEIGHTS_COMPRESSION_I8)
+                weightsCompression = Precision::I8;
+            else if (val == PluginConfigParams::WEIGHTS_COMPRESSION_BF16)
+                weightsCompression = Precision::BF16;
+            else if (val == PluginConfigParams::NO)
+                weightsCompression = Precision::UNSPECIFIED;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION
+                                   << ". Expected only " << PluginConfigParams::WEIGHTS_COMPRESSION_I8 << "/"
+                                   << PluginConfigParams::WEIGHTS_COMPRESSION_BF16 << "/" << PluginConfigParams::NO;
+        } else if (key == PluginConfigParams::KEY_CPU_LATENCY_MODE) {
+            if (val == PluginConfigParams::YES) latencyMode = true;
+            else if (val == PluginConfigParams::NO) latencyMode = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_LATENCY_MODE
+                                   << ". Expected only YES/NO";
         } else {
             THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property " << key << " by CPU plugin";
         }
@@ -127,6 +164,21 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_WEIGHTS_CACHE_DIR, weightsCacheDir });
+        _config.insert({ PluginConfigParams::KEY_CPU_PROFILING_REPORT, profilingReport });
+        _config.insert({ PluginConfigParams::KEY_CPU_BF16_CALIBRATION_DATA, bf16CalibrationData });
+        _config.insert({ PluginConfigParams::KEY_CPU_BF16_CALIBRATION_THRESHOLD,
+                         std::to_string(bf16CalibrationThreshold) });
+        if (latencyMode)
+            _config.insert({ PluginConfigParams::KEY_CPU_LATENCY_MODE, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_LATENCY_MODE, PluginConfigParams::NO });
+        if (weightsCompression == Precision::I8)
+            _config.insert({ PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, PluginConfigParams::WEIGHTS_COMPRESSION_I8 });
+        else if (weightsCompression == Precision::BF16)
+            _config.insert({ PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, PluginConfigParams::WEIGHTS_COMPRESSION_BF16 });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, PluginConfigParams::NO });
     }
 }
 
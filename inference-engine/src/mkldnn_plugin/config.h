@@ -6,6 +6,7 @@
 
 #include <string>
 #include <map>
+#include <ie_precision.hpp>
 #include <threading/ie_istreams_executor.hpp>
 
 namespace MKLDNNPlugin {
@@ -31,7 +32,14 @@ struct Config {
     std::string dumpToDot = "";
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
+    std::string weightsCacheDir = "";
+    std::string profilingReport = "";
+    std::string bf16CalibrationData = "";
+    float bf16CalibrationThreshold = 0.01f;
+    bool latencyMode = false;
     int batchLimit = 0;
+    // UNSPECIFIED keeps FullyConnected weights as is, I8 or BF16 stores them compressed
+    InferenceEngine::Precision weightsCompression = InferenceEngine::Precision::UNSPECIFIED;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
@@ -15,11 +15,15 @@ class MKLDNNAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadS
 public:
     MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr &inferRequest,
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
-                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
+                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
+                            bool inferOnCallingThread = false);
 
     void Infer_ThreadUnsafe() override;
 
     ~MKLDNNAsyncInferRequest() override;
+
+private:
+    bool _inferOnCallingThread;
 };
 
 }  // namespace MKLDNNPlugin
@@ -95,8 +95,22 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
             // If enforceBF16 flag was set, BF16 transformation applies for all layers supported by CPU plugin.
             // Overwise, only layers marked as BF16 in 'cnnetwork' will be performed in bfloat16 mode.
             // CPU plugin throws an exception, if marked as BF16 layers have not supported by CPU plugin.
-            if (cfg.enforceBF16 == true)
+            if (cfg.enforceBF16 == true) {
                 bf16Transformer.convertToBFloat16(cnnetwork);
+                if (!cfg.bf16CalibrationData.empty()) {
+                    bf16Transformer.calibrateToFloat(cnnetwork, cfg.bf16CalibrationData, cfg.bf16CalibrationThreshold,
+                                                     [&](CNNNetwork &calibrationNetwork) {
+                        auto localNetwork = cloneNet(static_cast<ICNNNetwork&>(calibrationNetwork));
+                        MKLDNNGraph::ApplyUnrollPasses(static_cast<ICNNNetwork&>(*localNetwork));
+                        auto graph = std::make_shared<MKLDNNGraph>();
+                        graph->setConfig(_cfg);
+                        // the calibration graphs are temporary, so their weights are not shared
+                        MKLDNNWeightsSharing::Ptr weightsCache;
+                        graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, weightsCache);
+                        return graph;
+                    });
+                }
+            }
         } else {
             BF16Transformer bf16Transformer;
             CNNNetwork cnnetwork(_clonedNetwork);
@@ -106,6 +120,16 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
 
     MKLDNNGraph::ApplyUnrollPasses(static_cast<ICNNNetwork&>(*_clonedNetwork));
 
+    if (_cfg.weightsCompression != Precision::UNSPECIFIED) {
+        // FullyConnected nodes decide themselves whether the compressed weights can be used
+        CNNNetworkIterator i(static_cast<ICNNNetwork*>(_clonedNetwork.get()));
+        while (i != CNNNetworkIterator()) {
+            if (CaselessEq<std::string>()((*i)->type, "FullyConnected"))
+                (*i)->params["weights_compression"] = _cfg.weightsCompression.name();
+            i++;
+        }
+    }
+
     if (_cfg.enableDynamicBatch) {
         // check topology for applicability
         if (!CanProcessDynBatch(*_clonedNetwork)) {
@@ -118,11 +142,9 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         _taskExecutor = ExecutorManager::getInstance()->getExecutor("CPU");
     } else {
         const int env_threads = parallel_get_env_threads();
-        const auto& numa_nodes = getAvailableNUMANodes();
-        const auto numa_nodes_num = numa_nodes.size();
         auto streamExecutorConfig = cfg.streamExecutorConfig;
-        // use logical cores only for single-socket targets in throughput mode
-        const int hw_cores = streamExecutorConfig._streams > 1 && numa_nodes_num == 1 ? parallel_get_max_threads() : getNumberOfCPUCores();
+        // streams get physical cores only, the SMT siblings would compete for the same core resources
+        const int hw_cores = getNumberOfCPUCores();
         const int threads = streamExecutorConfig._threads ? streamExecutorConfig._threads : (env_threads ? env_threads : hw_cores);
         streamExecutorConfig._threadsPerStream = streamExecutorConfig._streams
                                                 ? std::max(1, threads/streamExecutorConfig._streams)
@@ -137,22 +159,22 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         _callbackExecutor = _taskExecutor;
     }
 
-    _graphs = decltype(_graphs){[&] {
-        // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
-        //       is fixed and does not change content of network passed (CVS-26420)
-        auto localNetwork = cloneNet(static_cast<ICNNNetwork&>(*_clonedNetwork));
-        auto graph = std::make_shared<MKLDNNGraph>();
-        {
-            std::unique_lock<std::mutex> lock{_cfgMutex};
-            graph->setConfig(_cfg);
-        }
+    // The weights cache directory given to LoadNetwork differs from the one of the plugin,
+    // so the network shares the weights through a cache of its own
+    _weights = &numaNodesWeights;
+    if (_cfg.weightsCacheDir != numaNodesWeights.getPersistentDir()) {
+        _weightsSharing = std::make_shared<NumaNodesWeights>();
+        _weightsSharing->setPersistentDir(_cfg.weightsCacheDir);
+        _weights = _weightsSharing.get();
+    }
+
+    _graphs = decltype(_graphs){[this] {
         int numaNode = 0;
         auto* streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
         if (nullptr != streamExecutor) {
             numaNode = streamExecutor->GetNumaNodeId();
         }
-        graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, numaNodesWeights[numaNode]);
-        return graph;
+        return CreateGraph(numaNode);
     }};
 
     _taskExecutor->runAndWait({std::thread::hardware_concurrency(), [this] {_graphs.local();}});
@@ -175,6 +197,53 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
             }
         }
     }
+
+    // A graph bound to a request would not share the memory states kept by the stream graphs
+    if (_cfg.latencyMode) {
+        auto &nodes = _graphs.begin()->get()->GetNodes();
+        _inferOnCallingThread = std::none_of(nodes.begin(), nodes.end(), [](const MKLDNNNodePtr &node) {
+            return node->getType() == MemoryInput;
+        });
+    }
+    if (_inferOnCallingThread) {
+        for (auto &graph : _graphs)
+            _idleGraphs.push_back(graph);
+    }
+}
+
+MKLDNNGraph::Ptr MKLDNNExecNetwork::CreateGraph(int numaNode) {
+    // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
+    //       is fixed and does not change content of network passed (CVS-26420)
+    auto localNetwork = cloneNet(static_cast<ICNNNetwork&>(*_clonedNetwork));
+    auto graph = std::make_shared<MKLDNNGraph>();
+    {
+        std::unique_lock<std::mutex> lock{_cfgMutex};
+        graph->setConfig(_cfg);
+    }
+    graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, (*_weights)[numaNode]);
+    _compiledGraphs++;
+    return graph;
+}
+
+MKLDNNGraph::Ptr MKLDNNExecNetwork::AcquireGraph() {
+    {
+        std::lock_guard<std::mutex> lock{_idleGraphsMutex};
+        if (!_idleGraphs.empty()) {
+            auto graph = _idleGraphs.back();
+            _idleGraphs.pop_back();
+            return graph;
+        }
+    }
+    // More requests than streams, the calling thread is not bound to a NUMA node
+    auto graph = CreateGraph(0);
+    std::lock_guard<std::mutex> lock{_idleGraphsMutex};
+    _requestGraphs.push_back(graph);
+    return graph;
+}
+
+void MKLDNNExecNetwork::ReleaseGraph(const MKLDNNGraph::Ptr &graph) {
+    std::lock_guard<std::mutex> lock{_idleGraphsMutex};
+    _idleGraphs.push_back(graph);
 }
 
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
@@ -185,12 +254,17 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
     for (auto g : _graphs) {
         g->setProperty(properties);
     }
+    std::lock_guard<std::mutex> lock{_idleGraphsMutex};
+    for (auto &g : _requestGraphs) {
+        g->setProperty(properties);
+    }
 }
 
 void MKLDNNExecNetwork::CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) {
     auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
     syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
-    auto asyncRequestImpl = std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor, _callbackExecutor);
+    auto asyncRequestImpl = std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor, _callbackExecutor,
+                                                                      _inferOnCallingThread);
     asyncRequest.reset(new InferRequestBase<MKLDNNAsyncInferRequest>(asyncRequestImpl),
                        [](IInferRequest *p) { p->Release(); });
 
@@ -230,6 +304,10 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(CPU_ELIMINATED_REORDERS));
+        metrics.push_back(METRIC_KEY(CPU_REORDERED_BYTES));
+        metrics.push_back(METRIC_KEY(CPU_LATENCY_PLAN_STEPS));
+        metrics.push_back(METRIC_KEY(CPU_COMPILED_GRAPHS));
         result = IE_SET_METRIC(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -244,6 +322,14 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         auto streams = std::stoi(option->second);
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(CPU_ELIMINATED_REORDERS)) {
+        result = IE_SET_METRIC(CPU_ELIMINATED_REORDERS, static_cast<unsigned int>(_graphs.begin()->get()->eliminatedReorders));
+    } else if (name == METRIC_KEY(CPU_REORDERED_BYTES)) {
+        result = IE_SET_METRIC(CPU_REORDERED_BYTES, static_cast<uint64_t>(_graphs.begin()->get()->GetReorderedBytes()));
+    } else if (name == METRIC_KEY(CPU_LATENCY_PLAN_STEPS)) {
+        result = IE_SET_METRIC(CPU_LATENCY_PLAN_STEPS, static_cast<unsigned int>(_graphs.begin()->get()->GetLatencyPlanSize()));
+    } else if (name == METRIC_KEY(CPU_COMPILED_GRAPHS)) {
+        result = IE_SET_METRIC(CPU_COMPILED_GRAPHS, _compiledGraphs.load());
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -55,6 +55,21 @@ protected:
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    // Weights cache of the network, if it was loaded with a weights cache directory of its own
+    std::shared_ptr<NumaNodesWeights>           _weightsSharing;
+    // Latency mode: the synchronous Infer runs on the calling thread with the graph bound to the request
+    bool                                        _inferOnCallingThread = false;
+    NumaNodesWeights*                           _weights = nullptr;
+    std::atomic_uint                            _compiledGraphs = {0};
+    // Latency mode: the graphs not bound to any request, the stream graphs are bound first,
+    // and the graphs created when there were more requests than stream graphs
+    std::mutex                                  _idleGraphsMutex;
+    std::vector<MKLDNNGraph::Ptr>               _idleGraphs;
+    std::vector<MKLDNNGraph::Ptr>               _requestGraphs;
+
+    MKLDNNGraph::Ptr CreateGraph(int numaNode);
+    MKLDNNGraph::Ptr AcquireGraph();
+    void ReleaseGraph(const MKLDNNGraph::Ptr &graph);
 
 
     bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
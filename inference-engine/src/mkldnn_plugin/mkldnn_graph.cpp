@@ -19,6 +19,7 @@
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_memory_solver.hpp"
+#include "mkldnn_profiler.h"
 #include "mkldnn_itt.h"
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
@@ -91,8 +92,8 @@ void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr&
         MKLDNNWeightsSharing::Ptr &w_cache) {
     if (IsReady())
         ForgetGraphData();
-    // disable caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // disable caching if graph was created only once and the weights are not shared with other processes
+    weightsCache = config.streamExecutorConfig._streams != 1 || !config.weightsCacheDir.empty() ? w_cache : nullptr;
 
     Replicate(net, extMgr);
     InitGraph();
@@ -346,6 +347,7 @@ void MKLDNNGraph::InitGraph() {
     SortTopologically();
 
     InitDescriptors();
+    optimizer.ApplyLayoutOptimizations(*this);
 
     for (auto &node : graphNodes) {
         node->initOptimalPrimitiveDescriptor();
@@ -360,6 +362,12 @@ void MKLDNNGraph::InitGraph() {
 
     CreatePrimitives();
 
+    if (!config.profilingReport.empty())
+        enableProfiling(*this);
+
+    if (config.latencyMode)
+        CreateLatencyPlan();
+
     // Do it before cleanup. Because it will lose original layers information
     for (auto &graphNode : graphNodes) {
         auto nodeType = graphNode->getType();
@@ -705,6 +713,49 @@ void MKLDNNGraph::CreatePrimitives() {
     }
 }
 
+void MKLDNNGraph::CreateLatencyPlan() {
+    // The plan skips the per-node batch limit, performance counters and blob dumps
+#ifdef BLOB_DUMP_PATH
+    const bool withBlobDumps = true;
+#else
+    const bool withBlobDumps = false;
+#endif
+    if (withBlobDumps || config.enableDynamicBatch || config.batchLimit || config.collectPerfCounters || !config.profilingReport.empty())
+        return;
+
+    latencyPlan.clear();
+    for (auto &node : graphNodes) {
+        if (node->isConstant())
+            continue;
+
+        if (node->isExecutedByPrimitive()) {
+            if (!node->prim)
+                continue;
+            if (latencyPlan.empty() || latencyPlan.back().node)
+                latencyPlan.emplace_back();
+            auto primitive = *node->prim;
+            latencyPlan.back().primitives.push_back(primitive);
+            latencyPlan.back().handles.push_back(primitive.get());
+        } else {
+            ExecStep step;
+            step.node = node.get();
+            latencyPlan.push_back(step);
+        }
+    }
+    withLatencyPlan = true;
+}
+
+void MKLDNNGraph::InferLatencyPlan() {
+    mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+    for (auto &step : latencyPlan) {
+        if (step.node)
+            step.node->execute(stream);
+        else
+            mkldnn::error::wrap_c_api(mkldnn_stream_submit(stream.get(), step.handles.size(), step.handles.data(), nullptr),
+                                      "could not submit primitives");
+    }
+}
+
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
 
@@ -788,6 +839,12 @@ void MKLDNNGraph::Infer(int batch) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
+    if (withLatencyPlan && batch <= 0) {
+        InferLatencyPlan();
+        if (infer_count != -1) infer_count++;
+        return;
+    }
+
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
     for (int i = 0; i < graphNodes.size(); i++) {
         PERF(graphNodes[i]);
@@ -892,6 +949,17 @@ void MKLDNNGraph::SortTopologically() {
     }
 }
 
+size_t MKLDNNGraph::GetReorderedBytes() const {
+    size_t reorderedBytes = 0;
+    for (auto &node : graphNodes) {
+        if (node->getType() != Reorder || node->getChildEdges().empty())
+            continue;
+        auto edge = node->getChildEdgeAt(0);
+        reorderedBytes += static_cast<size_t>(edge->getDims().size()) * edge->getDesc().getPrecision().size();
+    }
+    return reorderedBytes;
+}
+
 void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
     unsigned i = 0;
     std::function<void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &, const MKLDNNNodePtr&)>
@@ -922,14 +990,20 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
     }
 
     if (!config.dumpToDot.empty()) dumpToDotFile(config.dumpToDot + "_perf.dot");
+    if (!config.profilingReport.empty()) dumpProfilingReport(*this, config.profilingReport);
 }
 
 void MKLDNNGraph::setConfig(const Config &cfg) {
     config = cfg;
+    // The rate is measured once per process, not while the counters are read
+    if (config.collectPerfCounters || !config.profilingReport.empty())
+        calibrateTimestamps();
 }
 
 void MKLDNNGraph::setProperty(const std::map<std::string, std::string>& properties) {
     config.readProperties(properties);
+    if (config.collectPerfCounters || !config.profilingReport.empty())
+        calibrateTimestamps();
 }
 
 Config MKLDNNGraph::getProperty() {
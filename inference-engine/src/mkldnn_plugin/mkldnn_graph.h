@@ -12,6 +12,7 @@
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
 #include "threading/ie_thread_local.hpp"
+#include "perf_count.h"
 #include <map>
 #include <string>
 #include <vector>
@@ -23,6 +24,8 @@ class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
     MKLDNNWeightsSharing::Ptr weightsCache;
+    // Number of reorders avoided by the layout assignment and removed by the graph optimizer
+    size_t eliminatedReorders = 0;
 
     enum Status {
         NotReady = 0,
@@ -77,6 +80,12 @@ public:
     }
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
+    // Number of bytes the reorders remaining in the graph move per inference
+    size_t GetReorderedBytes() const;
+    // Number of execution steps of the latency mode, 0 if the graph is executed node by node
+    size_t GetLatencyPlanSize() const {
+        return withLatencyPlan ? latencyPlan.size() : 0;
+    }
 
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
@@ -104,6 +113,10 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _meanImages.clear();
+        eliminatedReorders = 0;
+        traceBuffer.reset();
+        latencyPlan.clear();
+        withLatencyPlan = false;
     }
     Status status;
     Config config;
@@ -124,6 +137,21 @@ protected:
     std::map<std::string, MeanImage> _meanImages;
     std::string _name;
 
+    // Node executions recorded for the profiling report
+    std::unique_ptr<TraceBuffer> traceBuffer;
+
+    // Latency mode: the non-constant nodes in the execution order, bound once after the primitives are created.
+    // Adjacent nodes which only submit their primitives are merged into a single submission.
+    struct ExecStep {
+        MKLDNNNode *node = nullptr;  // nullptr means the step only submits the primitives
+        std::vector<mkldnn::primitive> primitives;
+        std::vector<mkldnn_primitive_t> handles;  // submitted directly through the C API
+    };
+    std::vector<ExecStep> latencyPlan;
+    bool withLatencyPlan = false;
+
+    size_t profilingId = 0;
+
     mkldnn::engine eng;
 
     void Replicate(const InferenceEngine::ICNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
@@ -135,6 +163,8 @@ protected:
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
+    void CreateLatencyPlan();
+    void InferLatencyPlan();
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
@@ -143,6 +173,8 @@ protected:
     friend class MKLDNNGraphlessInferRequest;
     friend std::shared_ptr<InferenceEngine::ICNNNetwork> dump_graph_as_ie_net(const MKLDNNGraph &graph);
     friend std::shared_ptr<InferenceEngine::ICNNNetwork> dump_graph_as_ie_ngraph_net(const MKLDNNGraph &graph);
+    friend void enableProfiling(MKLDNNGraph &graph);
+    friend void dumpProfilingReport(const MKLDNNGraph &graph, const std::string &prefix);
 
 private:
     void dumpToDotFile(std::string file) const;
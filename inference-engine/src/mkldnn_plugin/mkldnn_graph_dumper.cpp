@@ -235,6 +235,14 @@ std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &no
     }
     serialization_info[ExecGraphInfoSerialization::OUTPUT_PRECISIONS] = outputPrecisionsStr;
 
+    // The primitives compute in the precision of their first input, e.g. BF16 or FP32 for a convolution
+    if (!node->getParentEdges().empty()) {
+        serialization_info[ExecGraphInfoSerialization::RUNTIME_PRECISION] =
+                node->getParentEdgeAt(0)->getDesc().getPrecision().name();
+    } else {
+        serialization_info[ExecGraphInfoSerialization::RUNTIME_PRECISION] = outputPrecisionsStr;
+    }
+
     std::string outputLayoutsStr;
     auto outLayouts = node->getSelectedPrimitiveDescriptor()->getOutputLayouts();
     if (!outLayouts.empty()) {
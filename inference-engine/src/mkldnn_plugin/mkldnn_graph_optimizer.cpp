@@ -17,6 +17,7 @@
 #include "nodes/mkldnn_quantize_node.h"
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_resample_node.h"
+#include "nodes/mkldnn_generic_node.h"
 
 #include <blob_factory.hpp>
 #include <ie_layers_internal.hpp>
@@ -135,6 +136,13 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseNormalizeAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    FuseGenericAndSimpleOperation(graph);
+    graph.RemoveDroppedNodes();
+
+    // Runs after Conv+Sum fusing which is preferable for residual connections
+    FuseScaleShiftAndEltwise(graph);
+    graph.RemoveDroppedNodes();
+
     FuseEltwiseAndSimple(graph);
     graph.RemoveDroppedNodes();
 
@@ -146,8 +154,13 @@ void MKLDNNGraphOptimizer::ApplyImplSpecificGraphOptimizations(MKLDNNGraph &grap
     graph.RemoveDroppedNodes();
 
 #if defined (COMPILED_CPU_MKLDNN_REORDER_NODE)
-    DropDoubleReorders(graph);
-    graph.RemoveDroppedNodes();
+    // Merging a pair may produce a new pair with the next reorder of a chain
+    size_t eliminatedReorders;
+    do {
+        eliminatedReorders = graph.eliminatedReorders;
+        DropDoubleReorders(graph);
+        graph.RemoveDroppedNodes();
+    } while (eliminatedReorders != graph.eliminatedReorders);
 
     DropConvertReorder(graph);
     graph.RemoveDroppedNodes();
@@ -156,6 +169,115 @@ void MKLDNNGraphOptimizer::ApplyImplSpecificGraphOptimizations(MKLDNNGraph &grap
     graph.RemoveDroppedEdges();
 }
 
+void MKLDNNGraphOptimizer::ApplyLayoutOptimizations(MKLDNNGraph &graph) {
+    // Nodes select primitive descriptors one by one looking at their parents only. Revisit the choice for the whole graph:
+    // a node switches to another layout of the same implementation if that reduces the amount of data reordered
+    // on all its input and output edges. Every switch strictly decreases the total reorder cost, so the search converges.
+    auto getParentDesc = [](const MKLDNNEdgePtr& edge) -> const TensorDesc* {
+        auto parentPD = edge->getParent()->getSelectedPrimitiveDescriptor();
+        if (parentPD == nullptr || parentPD->getConfig().outConfs.empty())
+            return nullptr;
+        int inNum = edge->getInputNum();
+        if (inNum < 0 || inNum >= parentPD->getConfig().outConfs.size())
+            inNum = 0;
+        return &parentPD->getConfig().outConfs[inNum].desc;
+    };
+
+    auto getChildDesc = [](const MKLDNNEdgePtr& edge) -> const TensorDesc* {
+        auto childPD = edge->getChild()->getSelectedPrimitiveDescriptor();
+        int outNum = edge->getOutputNum();
+        if (childPD == nullptr || outNum < 0 || outNum >= childPD->getConfig().inConfs.size())
+            return nullptr;
+        return &childPD->getConfig().inConfs[outNum].desc;
+    };
+
+    auto reorderCost = [](const MKLDNNEdgePtr& edge, const TensorDesc* parentDesc, const TensorDesc* childDesc) -> size_t {
+        if (parentDesc == nullptr || childDesc == nullptr || MKLDNNExtensionUtils::initTensorsAreEqual(*parentDesc, *childDesc))
+            return 0;
+        return static_cast<size_t>(edge->getDims().size()) *
+               (std::max)(parentDesc->getPrecision().size(), childDesc->getPrecision().size());
+    };
+
+    auto nodeCost = [&](const MKLDNNNodePtr& node, const LayerConfig& config) {
+        size_t cost = 0;
+        for (size_t i = 0; i < config.inConfs.size() && i < node->getParentEdges().size(); i++) {
+            auto edge = node->getParentEdgeAt(i);
+            cost += reorderCost(edge, getParentDesc(edge), &config.inConfs[i].desc);
+        }
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto edge = node->getChildEdgeAt(i);
+            int inNum = edge->getInputNum();
+            if (inNum < 0 || inNum >= config.outConfs.size())
+                continue;
+            cost += reorderCost(edge, &config.outConfs[inNum].desc, getChildDesc(edge));
+        }
+        return cost;
+    };
+
+    auto countReorders = [&]() {
+        size_t count = 0;
+        for (auto &edge : graph.GetEdges()) {
+            if (reorderCost(edge, getParentDesc(edge), getChildDesc(edge)) != 0)
+                count++;
+        }
+        return count;
+    };
+
+    // Concat and Split select descriptors by their own rules to work in place
+    const std::vector<MKLDNNPlugin::Type> skippedTypes = {Input, Output, Concatenation, Split, Reorder, MemoryInput, MemoryOutput, TensorIterator};
+    auto isSutableNode = [&](const MKLDNNNodePtr& node) {
+        return node->getSupportedPrimitiveDescriptors().size() > 1 && node->getSelectedPrimitiveDescriptor() != nullptr &&
+               std::find(skippedTypes.begin(), skippedTypes.end(), node->getType()) == skippedTypes.end();
+    };
+
+    auto tryReselect = [&](const MKLDNNNodePtr& node) {
+        if (!isSutableNode(node))
+            return false;
+
+        const auto& supported = node->getSupportedPrimitiveDescriptors();
+        const auto selectedType = node->getSelectedPrimitiveDescriptor()->getImplementationType();
+        int selected = -1;
+        for (size_t i = 0; i < supported.size(); i++) {
+            if (&supported[i] == node->getSelectedPrimitiveDescriptor())
+                selected = static_cast<int>(i);
+        }
+
+        size_t bestCost = nodeCost(node, supported[selected].getConfig());
+        int best = selected;
+        for (size_t i = 0; i < supported.size() && bestCost != 0; i++) {
+            if (supported[i].getImplementationType() != selectedType ||
+                supported[i].getConfig().inConfs.size() > node->getParentEdges().size())
+                continue;
+            size_t cost = nodeCost(node, supported[i].getConfig());
+            if (cost < bestCost) {
+                bestCost = cost;
+                best = static_cast<int>(i);
+            }
+        }
+        if (best == selected)
+            return false;
+
+        node->selectPrimitiveDescriptorByIndex(best);
+        return true;
+    };
+
+    auto& graphNodes = graph.GetNodes();
+    const size_t reordersBefore = countReorders();
+    const int maxIterations = 4;
+    for (int iteration = 0; iteration < maxIterations; iteration++) {
+        bool changed = false;
+        for (auto it = graphNodes.begin(); it != graphNodes.end(); it++)
+            changed = tryReselect(*it) || changed;
+        for (auto it = graphNodes.rbegin(); it != graphNodes.rend(); it++)
+            changed = tryReselect(*it) || changed;
+        if (!changed)
+            break;
+    }
+    const size_t reordersAfter = countReorders();
+    if (reordersBefore > reordersAfter)
+        graph.eliminatedReorders += reordersBefore - reordersAfter;
+}
+
 void MKLDNNGraphOptimizer::MergeConversions(MKLDNNGraph& graph) {
     for (auto node : graph.GetNodes()) {
         // Input with at least 2 Convertions
@@ -1818,6 +1940,95 @@ void MKLDNNGraphOptimizer::FuseNormalizeAndSimpleOperation(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseGenericAndSimpleOperation(MKLDNNGraph &graph) {
+    auto isOneOf = [&](mkldnn::algorithm alg, std::vector<mkldnn::algorithm> algs) {
+        for (auto a : algs) {
+            if (alg == a) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    auto removeEdge = [](MKLDNNGraph &graph, MKLDNNEdgePtr& edge) {
+        auto& edges = graph.GetEdges();
+        for (auto it = edges.begin(); it != edges.end(); it++) {
+            if ((*it) == edge) {
+                edges.erase(it);
+                return;
+            }
+        }
+    };
+
+    auto& graphNodes = graph.GetNodes();
+
+    // Extension layers implemented in the plugin apply fused operations to their FP32 output in place
+    auto isSutableParentNode = [](MKLDNNNodePtr node) {
+        if (node->getType() != Generic || node->getChildEdges().size() != 1)
+            return false;
+
+        auto* genericNode = dynamic_cast<MKLDNNGenericNode *>(node.get());
+        return genericNode != nullptr && genericNode->canFusePostOps();
+    };
+
+    auto isSutableChildNode = [&](MKLDNNNodePtr node) {
+        if (!node->getCnnLayer() || node->getCnnLayer()->outData.empty() ||
+            node->getCnnLayer()->outData[0]->getPrecision() != Precision::FP32)
+            return false;
+
+        if (node->getType() == Quantize) {
+            auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
+            if (quantizeNode == nullptr)
+                THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
+            return !quantizeNode->isBinarization();
+        } else if (node->getType() == Depthwise) {
+            auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode*>(node.get());
+            if (depthwiseNode == nullptr)
+                THROW_IE_EXCEPTION << "Cannot get depthwise layer " << node->getName();
+            return ((depthwiseNode->getAlgorithm() == mkldnn::algorithm::depthwise_scale_shift && depthwiseNode->isWithBiases()) ||
+                    (depthwiseNode->getAlgorithm() == mkldnn::algorithm::depthwise_prelu));
+        } else if (node->getType() == Activation) {
+            auto* activationNode = dynamic_cast<MKLDNNActivationNode*>(node.get());
+            if (activationNode == nullptr)
+                THROW_IE_EXCEPTION << "Cannot get activation layer " << node->getName();
+            return isOneOf(activationNode->getAlgorithm(), {eltwise_relu, eltwise_gelu, eltwise_elu, eltwise_logistic,
+                eltwise_bounded_relu, eltwise_clamp, eltwise_tanh, eltwise_swish, eltwise_linear, eltwise_abs,
+                eltwise_square, eltwise_sqrt});
+        }
+        return false;
+    };
+
+    auto parent = graphNodes.begin();
+    while (parent != graphNodes.end()) {
+        auto parentNode = *parent;
+        if (!isSutableParentNode(parentNode)) {
+            parent++;
+            continue;
+        }
+
+        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+        if (!isSutableChildNode(childNode)) {
+            parent++;
+            continue;
+        }
+
+        parentNode->fuseWith(childNode);
+
+        if (childNode->getType() == Quantize) {
+            auto parentEdges = childNode->parentEdges;
+            for (auto &parentEdge : parentEdges) {
+                auto p_edge = parentEdge.lock();
+                if (p_edge->getParent() == parentNode)
+                    continue;
+
+                removeEdge(graph, p_edge);
+            }
+        }
+
+        graph.DropNode(childNode);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
     auto isOneOf = [&](mkldnn::algorithm alg, std::vector<mkldnn::algorithm> algs) {
         for (auto a : algs) {
@@ -1972,15 +2183,11 @@ void MKLDNNGraphOptimizer::DropDoubleReorders(MKLDNNGraph &graph) {
             if (nn == nullptr)
                 THROW_IE_EXCEPTION << "Cannot get reorder layer " << nextNode->getName();
 
-            auto scales = n->_scales;
+            // Merging scales of two subsequent reorders is unsupported yet, such a pair is kept as is
+            if (n->_scales != nullptr && nn->_scales != nullptr)
+                continue;
 
-            if (n->_scales != nullptr && nn->_scales != nullptr) {
-                THROW_IE_EXCEPTION << "Merging scales of two subsequent reorders is unsupported yet";
-            } else {
-                if (scales == nullptr) {
-                    scales = nn->_scales;
-                }
-            }
+            auto scales = n->_scales != nullptr ? n->_scales : nn->_scales;
 
             MKLDNNNodePtr p = n->getParentEdgeAt(0)->getParent();
             MKLDNNNodePtr c = nn->getChildEdgeAt(0)->getChild();
@@ -2000,6 +2207,12 @@ void MKLDNNGraphOptimizer::DropDoubleReorders(MKLDNNGraph &graph) {
             }
             if (!edge) THROW_IE_EXCEPTION << "Inappropriate graph processing";
 
+            // The second reorder converts the data back, so the pair is not needed at all
+            if (scales == nullptr && MKLDNNExtensionUtils::initTensorsAreEqual(n->getInput(), nn->getOutput())) {
+                graph.eliminatedReorders += 2;
+                continue;
+            }
+            graph.eliminatedReorders++;
 
             std::string layerName = edge->getParent()->getName() + "_ScaleReorder_" + edge->getChild()->getName();
             CNNLayerPtr layer(new CNNLayer({layerName,
@@ -2249,6 +2462,50 @@ void MKLDNNGraphOptimizer::FuseClampAndQuantize(MKLDNNGraph &graph) {
     }
 }
 
+// Folds x * scales + shifts computed before the quantization into the quantize node, scales must be positive
+static void foldScaleShiftIntoQuantize(MKLDNNQuantizeNode *quantizeNode, const std::vector<float> &scales,
+                                       const std::vector<float> &shifts) {
+    const std::vector<float>& cropLowData = quantizeNode->getCropLow();
+    const std::vector<float>& cropHighData = quantizeNode->getCropHigh();
+    const std::vector<float>& inputScaleData = quantizeNode->getInputScale();
+    const std::vector<float>& inputShiftData = quantizeNode->getInputShift();
+
+    std::vector<float> newCropLow(scales.size());
+    std::vector<float> newCropHigh(scales.size());
+    std::vector<float> newInputScale(scales.size());
+    std::vector<float> newInputShift(scales.size());
+
+    for (int i = 0; i < newCropLow.size(); i++) {
+        float cl = cropLowData.size() == 1 ? cropLowData[0] : cropLowData[i];
+
+        newCropLow[i] = (cl - shifts[i]) / scales[i];
+    }
+
+    for (int i = 0; i < newCropHigh.size(); i++) {
+        float ch = cropHighData.size() == 1 ? cropHighData[0] : cropHighData[i];
+
+        newCropHigh[i] = (ch - shifts[i]) / scales[i];
+    }
+
+    for (int i = 0; i < newInputScale.size(); i++) {
+        float isc = inputScaleData.size() == 1 ? inputScaleData[0] : inputScaleData[i];
+
+        newInputScale[i] = isc * scales[i];
+    }
+
+    for (int i = 0; i < newInputShift.size(); i++) {
+        float isc = inputScaleData.size() == 1 ? inputScaleData[0] : inputScaleData[i];
+        float ish = inputShiftData.size() == 1 ? inputShiftData[0] : inputShiftData[i];
+
+        newInputShift[i] = ish + shifts[i] * isc;
+    }
+
+    quantizeNode->setCropLow(newCropLow);
+    quantizeNode->setCropHigh(newCropHigh);
+    quantizeNode->setInputScale(newInputScale);
+    quantizeNode->setInputShift(newInputShift);
+}
+
 void MKLDNNGraphOptimizer::FuseScaleShiftAndQuantize(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -2311,58 +2568,130 @@ void MKLDNNGraphOptimizer::FuseScaleShiftAndQuantize(MKLDNNGraph &graph) {
             if (scalesBufferPtr[i] <= 0.f)
                 return false;
 
-        const std::vector<float>& cropLowData = quantizeNode->getCropLow();
-        const std::vector<float>& cropHighData = quantizeNode->getCropHigh();
-        const std::vector<float>& inputScaleData = quantizeNode->getInputScale();
-        const std::vector<float>& inputShiftData = quantizeNode->getInputShift();
+        foldScaleShiftIntoQuantize(quantizeNode, std::vector<float>(scalesBufferPtr, scalesBufferPtr + scalesBlob->size()),
+                                   std::vector<float>(shiftsBufferPtr, shiftsBufferPtr + shiftsBlob->size()));
 
-        std::vector<float> newCropLow(scalesBlob->size());
-        std::vector<float> newCropHigh(scalesBlob->size());
-        std::vector<float> newInputScale(scalesBlob->size());
-        std::vector<float> newInputShift(scalesBlob->size());
+        // Quantize reads INT8 data as is, without a conversion to FP32
+        auto inputPrecision = depthwiseLayer->insData[0].lock()->getPrecision();
+        if (inputPrecision == Precision::U8 || inputPrecision == Precision::I8)
+            quantizeNode->setInputPrecision(inputPrecision);
 
-        for (int i = 0; i < newCropLow.size(); i++) {
-            float cl = cropLowData.size() == 1 ? cropLowData[0] : cropLowData[i];
+        return true;
+    };
 
-            newCropLow[i] = (cl - shiftsBufferPtr[i]) / scalesBufferPtr[i];
-        }
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto parent = graphNodes[i];
+        if (!isSutableScaleShiftNode(parent)) continue;
 
-        for (int i = 0; i < newCropHigh.size(); i++) {
-            float ch = cropHighData.size() == 1 ? cropHighData[0] : cropHighData[i];
+        auto child = parent->getChildEdgeAt(0)->getChild();
+        if (!isSutableQuantizeNode(child)) continue;
 
-            newCropHigh[i] = (ch - shiftsBufferPtr[i]) / scalesBufferPtr[i];
+        if (fuseScaleShiftAndQuantizeNodes(parent, child)) {
+            graph.DropNode(parent);
         }
+    }
+}
 
-        for (int i = 0; i < newInputScale.size(); i++) {
-            float isc = inputScaleData.size() == 1 ? inputScaleData[0] : inputScaleData[i];
+// ScaleShift which dequantizes INT8 data
+static bool isDequantizationScaleShift(const MKLDNNNodePtr &node) {
+    if (node->getType() != Depthwise || !node->getCnnLayer())
+        return false;
 
-            newInputScale[i] = isc * scalesBufferPtr[i];
-        }
+    auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
+    if (depthwiseNode == nullptr)
+        THROW_IE_EXCEPTION << "Cannot cast " << node->getName() << " to Depthwise node";
 
-        for (int i = 0; i < newInputShift.size(); i++) {
-            float isc = inputScaleData.size() == 1 ? inputScaleData[0] : inputScaleData[i];
-            float ish = inputShiftData.size() == 1 ? inputShiftData[0] : inputShiftData[i];
+    if (depthwiseNode->getChildEdges().size() != 1 || depthwiseNode->getAlgorithm() != depthwise_scale_shift)
+        return false;
 
-            newInputShift[i] = ish + shiftsBufferPtr[i] * isc;
-        }
+    auto inputPrecision = depthwiseNode->getCnnLayer()->insData[0].lock()->getPrecision();
+    return inputPrecision == Precision::U8 || inputPrecision == Precision::I8;
+}
 
-        quantizeNode->setCropLow(newCropLow);
-        quantizeNode->setCropHigh(newCropHigh);
-        quantizeNode->setInputScale(newInputScale);
-        quantizeNode->setInputShift(newInputShift);
+// Reads the values of a ScaleShift node, per tensor values are repeated for every channel
+static bool getScaleShiftValues(const MKLDNNNodePtr &node, size_t channels,
+                                std::vector<float> &scales, std::vector<float> &shifts) {
+    auto depthwiseLayer = node->getCnnLayer();
 
-        return true;
+    Blob::Ptr scalesBlob = depthwiseLayer->blobs["weights"];
+    Blob::Ptr shiftsBlob = depthwiseLayer->blobs["biases"];
+    if (scalesBlob == nullptr || shiftsBlob == nullptr)
+        return false;
+
+    if ((scalesBlob->size() != channels && scalesBlob->size() != 1) ||
+        (shiftsBlob->size() != channels && shiftsBlob->size() != 1))
+        return false;
+
+    const float* scalesBufferPtr = scalesBlob->buffer().as<float*>();
+    const float* shiftsBufferPtr = shiftsBlob->buffer().as<float*>();
+
+    scales.resize(channels);
+    shifts.resize(channels);
+    for (size_t c = 0; c < channels; c++) {
+        scales[c] = scalesBufferPtr[scalesBlob->size() == 1 ? 0 : c];
+        shifts[c] = shiftsBufferPtr[shiftsBlob->size() == 1 ? 0 : c];
+    }
+
+    return true;
+}
+
+void MKLDNNGraphOptimizer::FuseScaleShiftAndEltwise(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSutableEltwiseNode = [](MKLDNNNodePtr node) {
+        if (node->getType() != Eltwise)
+            return false;
+
+        auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
+        if (eltwiseNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot cast " << node->getName() << " to Eltwise node";
+
+        auto *eltwiseLayer = dynamic_cast<EltwiseLayer *>(node->getCnnLayer().get());
+        if (eltwiseLayer == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get Eltwise layer " << node->getName();
+
+        // Conditions of the JIT kernel, it vectorizes the innermost channels dimension
+        if (node->getParentEdges().size() != 2 || !eltwiseNode->isUnitScales())
+            return false;
+
+        if (eltwiseLayer->_operation != EltwiseLayer::Sum && eltwiseLayer->_operation != EltwiseLayer::Prod)
+            return false;
+
+        auto& outDims = node->getChildEdgeAt(0)->getDims();
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto ndims = node->getParentEdgeAt(i)->getDims().ndims();
+            if (ndims != outDims.ndims() || (ndims != 2 && ndims != 4 && ndims != 5))
+                return false;
+        }
+
+        int simdWidth = mkldnn::impl::cpu::mayiuse(impl::cpu::cpu_isa_t::avx512_common) ? 16 :
+                        mkldnn::impl::cpu::mayiuse(impl::cpu::cpu_isa_t::avx2) ? 8 : 4;
+        return outDims[1] >= simdWidth;
     };
 
     for (int i = 0; i < graphNodes.size(); i++) {
-        auto parent = graphNodes[i];
-        if (!isSutableScaleShiftNode(parent)) continue;
+        auto eltwise = graphNodes[i];
+        if (!isSutableEltwiseNode(eltwise)) continue;
 
-        auto child = parent->getChildEdgeAt(0)->getChild();
-        if (!isSutableQuantizeNode(child)) continue;
+        // DropNode reorders the parent edges, so the inputs are collected by port numbers first
+        std::vector<std::pair<int, MKLDNNNodePtr>> scaleShifts;
+        for (size_t j = 0; j < eltwise->getParentEdges().size(); j++) {
+            auto parentEdge = eltwise->getParentEdgeAt(j);
+            if (isDequantizationScaleShift(parentEdge->getParent()))
+                scaleShifts.emplace_back(parentEdge->getOutputNum(), parentEdge->getParent());
+        }
 
-        if (fuseScaleShiftAndQuantizeNodes(parent, child)) {
-            graph.DropNode(parent);
+        auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(eltwise.get());
+        for (auto &scaleShift : scaleShifts) {
+            auto& depthwise = scaleShift.second;
+
+            std::vector<float> scales, shifts;
+            if (!getScaleShiftValues(depthwise, depthwise->getChildEdgeAt(0)->getDims()[1], scales, shifts))
+                continue;
+
+            eltwiseNode->fuseInputScaleShift(scaleShift.first, depthwise->getCnnLayer()->insData[0].lock()->getPrecision(),
+                                             std::move(scales), std::move(shifts));
+            graph.DropNode(depthwise);
         }
     }
 }
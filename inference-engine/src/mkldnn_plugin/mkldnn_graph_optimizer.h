@@ -16,6 +16,7 @@ public:
 public:
     void ApplyCommonGraphOptimizations(MKLDNNGraph& graph);
     void ApplyImplSpecificGraphOptimizations(MKLDNNGraph& graph);
+    void ApplyLayoutOptimizations(MKLDNNGraph& graph);
 
 private:
     void SLTMTransform(MKLDNNGraph& graph);
@@ -44,6 +45,7 @@ private:
     void FuseMVNAndSimpleOperation(MKLDNNGraph &graph);
     void FuseResampleAndSimpleOperation(MKLDNNGraph &graph);
     void FuseNormalizeAndSimpleOperation(MKLDNNGraph &graph);
+    void FuseGenericAndSimpleOperation(MKLDNNGraph &graph);
     void RemoveIdentityOperator(MKLDNNGraph& graph);
 
     void RemoveIOScaleShifts(MKLDNNGraph& graph);
@@ -55,6 +57,7 @@ private:
     void FuseBroadcastAndEltwise(MKLDNNGraph &graph);
     void FuseEltwiseAndSimple(MKLDNNGraph &graph);
     void FuseScaleShiftAndQuantize(MKLDNNGraph &graph);
+    void FuseScaleShiftAndEltwise(MKLDNNGraph &graph);
     void FuseClampAndQuantize(MKLDNNGraph &graph);
 
     bool IsOneOf(Type type, std::vector<Type> types);
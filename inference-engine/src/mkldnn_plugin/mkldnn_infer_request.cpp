@@ -25,7 +25,14 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
 
     if (execNetwork->_graphs.size() == 0)
         THROW_IE_EXCEPTION << "No graph was found";
-    graph = execNetwork->_graphs.begin()->get();
+    // In the latency mode the request infers on the calling thread with a graph of its own,
+    // so no graph is compiled on the first inference of a new thread
+    if (execNetwork->_inferOnCallingThread) {
+        boundGraph = execNetwork->AcquireGraph();
+        graph = boundGraph.get();
+    } else {
+        graph = execNetwork->_graphs.begin()->get();
+    }
     for (const auto& it : _networkInputs) {
         InferenceEngine::Blob::Ptr blob;
         MKLDNNInferRequest::GetBlob(it.first.c_str(), blob);
@@ -39,6 +46,8 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
 
 MKLDNNPlugin::MKLDNNInferRequest::~MKLDNNInferRequest() {
     --(execNetwork->_numRequests);
+    if (boundGraph)
+        execNetwork->ReleaseGraph(boundGraph);
 }
 
 template <typename T>
@@ -82,7 +91,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
 
-    graph = execNetwork->_graphs.local().get();
+    if (!boundGraph)
+        graph = execNetwork->_graphs.local().get();
     {
         execDataPreprocessing(_inputs);
 
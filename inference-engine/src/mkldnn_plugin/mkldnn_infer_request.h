@@ -49,6 +49,8 @@ private:
     void changeDefaultPtr();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
+    // Latency mode: the graph used by this request only
+    MKLDNNGraph::Ptr                    boundGraph;
     std::map<std::string, void*>        externalPtr;
     openvino::itt::handle_t             profilingTask;
 };
@@ -772,14 +772,12 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
 
         MKLDNNMemoryPtr ptr;
         if (weightCache != nullptr) {
-            const uint64_t data_hash = weightCache->GetHashFunc().hash(
-                    internalBlob->buffer(), internalBlob->byteSize());
+            // the key depends on the content and the target layout only, so equal weights of
+            // different layers and networks are reordered once
+            const std::string string_hash = MKLDNNWeightsSharing::GetKey(internalBlob->buffer(), internalBlob->byteSize(),
+                                                                         intDescs[i]);
 
-            const std::string string_hash = name + "_" + std::to_string(i)
-                                            + "_" + std::to_string(internalBlob->byteSize())
-                                            + "_" + std::to_string(data_hash);
-
-            ptr = weightCache->findOrCreate(string_hash, create);
+            ptr = weightCache->findOrCreate(string_hash, intDescs[i], engine, create);
         } else {
             ptr = create();
         }
@@ -333,7 +333,7 @@ public:
             selectedPrimitiveDescriptorIndex = index;
     }
 
-    std::string getPrimitiveDescriptorType();
+    virtual std::string getPrimitiveDescriptorType();
 
     PerfCount &PerfCounter() { return perfCounter; }
 
@@ -341,6 +341,11 @@ public:
 
     void resolveNotAllocatedEdges();
     virtual void execute(mkldnn::stream strm);
+    /**
+     * @brief Returns true if execute() only submits the primitive of the node, so the graph in the latency mode
+     * can submit it together with the primitives of the neighbouring nodes
+     */
+    virtual bool isExecutedByPrimitive() const { return false; }
     virtual void initSupportedPrimitiveDescriptors();
 
     /**
@@ -0,0 +1,256 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_profiler.h"
+
+#include <atomic>
+#include <cctype>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+std::once_flag calibrationFlag;
+// Without the time stamp counter readTimestamp() returns nanoseconds
+double calibratedRate = 1000.0;
+
+}  // namespace
+
+void calibrateTimestamps() {
+    std::call_once(calibrationFlag, [] {
+#ifdef MKLDNN_PLUGIN_HAS_TSC
+        using clock = std::chrono::steady_clock;
+        const auto startTime = clock::now();
+        const uint64_t startTimestamp = readTimestamp();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        const uint64_t finishTimestamp = readTimestamp();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - startTime).count();
+        calibratedRate = static_cast<double>(finishTimestamp - startTimestamp) * 1000.0 / elapsed;
+#endif
+    });
+}
+
+double timestampsPerMicrosecond() {
+    calibrateTimestamps();
+    return calibratedRate;
+}
+
+namespace {
+
+// Node executions kept for the trace, the latest ones overwrite the oldest
+const size_t traceCapacity = 1 << 16;
+
+uint64_t edgeBytes(const MKLDNNEdgePtr &edge) {
+    return static_cast<uint64_t>(edge->getDims().size()) * edge->getDesc().getPrecision().size();
+}
+
+uint64_t edgeElements(const MKLDNNEdgePtr &edge) {
+    return static_cast<uint64_t>(edge->getDims().size());
+}
+
+std::string jsonString(const std::string &str) {
+    std::string res = "\"";
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            res += '\\';
+            res += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            res += ' ';
+        } else {
+            res += c;
+        }
+    }
+    return res + "\"";
+}
+
+// Network names may contain path separators and other characters which are not valid in a file name
+std::string fileNamePart(const std::string &str) {
+    std::string res = str;
+    for (auto &c : res) {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '-' && c != '_' && c != '.')
+            c = '_';
+    }
+    return res;
+}
+
+// Upper bound of the time of the given share of the executions in microseconds
+double percentile(const PerfCount &counter, double share, double rate) {
+    auto &hist = counter.histogram();
+    uint64_t target = static_cast<uint64_t>(share * counter.count());
+    uint64_t seen = 0;
+    for (size_t b = 0; b < hist.size(); b++) {
+        seen += hist[b];
+        if (seen > target || seen == counter.count())
+            return static_cast<double>(uint64_t(1) << (b + 1)) / rate;
+    }
+    return 0;
+}
+
+void estimateNodeWorkload(const MKLDNNNodePtr &node) {
+    uint64_t bytes = 0;
+    uint64_t inElements = 0;
+    for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+        auto edge = node->getParentEdgeAt(i);
+        bytes += edgeBytes(edge);
+        if (i == 0)
+            inElements = edgeElements(edge);
+    }
+
+    // Every output port is written once whatever number of consumers it has
+    uint64_t outElements = 0;
+    std::set<int> ports;
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        auto edge = node->getChildEdgeAt(i);
+        if (!ports.insert(edge->getInputNum()).second)
+            continue;
+        bytes += edgeBytes(edge);
+        if (edge->getInputNum() == 0)
+            outElements = edgeElements(edge);
+    }
+
+    uint64_t weightsElements = 0;
+    auto layer = node->getCnnLayer();
+    if (layer) {
+        for (auto &blob : layer->blobs) {
+            if (!blob.second)
+                continue;
+            bytes += blob.second->byteSize();
+            if (blob.first == "weights")
+                weightsElements = blob.second->size();
+        }
+    }
+
+    // Multiply-accumulate layers count two operations per weight and spatial point, the others one per output element
+    uint64_t flops = outElements;
+    switch (node->getType()) {
+        case Convolution:
+        case BinaryConvolution:
+        case DeformableConvolution:
+        case FullyConnected: {
+            auto edge = node->getChildEdgeAt(0);
+            uint64_t outChannels = edge->getDims().ndims() > 1 ? edge->getDims()[1] : 1;
+            if (weightsElements && outChannels)
+                flops = 2 * outElements / outChannels * weightsElements;
+            break;
+        }
+        case Deconvolution: {
+            auto edge = node->getParentEdgeAt(0);
+            uint64_t inChannels = edge->getDims().ndims() > 1 ? edge->getDims()[1] : 1;
+            if (weightsElements && inChannels)
+                flops = 2 * inElements / inChannels * weightsElements;
+            break;
+        }
+        case Gemm: {
+            auto &dims = node->getParentEdgeAt(0)->getDims();
+            bool transposeA = layer && layer->GetParamAsBool("transpose_a", false);
+            if (dims.ndims() > 1)
+                flops = 2 * outElements * dims[transposeA ? dims.ndims() - 2 : dims.ndims() - 1];
+            break;
+        }
+        default:
+            break;
+    }
+    // Fused post operations are applied to the output
+    flops += outElements * (node->getFusedWith().size() + node->getMergeWith().size());
+
+    node->PerfCounter().setWorkload(bytes, flops);
+}
+
+}  // namespace
+
+void enableProfiling(MKLDNNGraph &graph) {
+    static std::atomic<size_t> nextProfilingId{0};
+    graph.profilingId = nextProfilingId++;
+
+    graph.traceBuffer.reset(new TraceBuffer(traceCapacity));
+    for (size_t i = 0; i < graph.graphNodes.size(); i++) {
+        auto &node = graph.graphNodes[i];
+        estimateNodeWorkload(node);
+        node->PerfCounter().setTrace(graph.traceBuffer.get(), static_cast<uint32_t>(i));
+    }
+}
+
+void dumpProfilingReport(const MKLDNNGraph &graph, const std::string &prefix) {
+    const std::string name = prefix + "_" + fileNamePart(graph._name) + "_" + std::to_string(graph.profilingId);
+    const double rate = timestampsPerMicrosecond();
+
+    std::ofstream trace(name + "_trace.json");
+    if (trace.is_open() && graph.traceBuffer) {
+        uint64_t origin = 0;
+        graph.traceBuffer->forEach([&](const TraceBuffer::Event &event) {
+            if (origin == 0 || event.start < origin)
+                origin = event.start;
+        });
+
+        trace << "{\"traceEvents\":[";
+        bool first = true;
+        graph.traceBuffer->forEach([&](const TraceBuffer::Event &event) {
+            if (event.node >= graph.graphNodes.size())
+                return;
+            auto &node = graph.graphNodes[event.node];
+            trace << (first ? "\n" : ",\n");
+            trace << "{\"name\":" << jsonString(node->getName())
+                  << ",\"cat\":" << jsonString(node->getTypeStr())
+                  << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << graph.profilingId
+                  << ",\"ts\":" << (event.start - origin) / rate
+                  << ",\"dur\":" << (event.finish - event.start) / rate << "}";
+            first = false;
+        });
+        trace << "\n]}\n";
+    }
+
+    std::ofstream roofline(name + "_roofline.json");
+    if (!roofline.is_open())
+        return;
+
+    roofline << "{\"timestamps_per_us\":" << rate << ",\"histogram_bucket_bounds_us\":[";
+    for (size_t b = 0; b < PerfCount::histogramSize; b++)
+        roofline << (b ? "," : "") << static_cast<double>(uint64_t(1) << (b + 1)) / rate;
+    roofline << "],\"nodes\":[";
+
+    bool first = true;
+    for (auto &node : graph.graphNodes) {
+        auto &counter = node->PerfCounter();
+        if (counter.count() == 0)
+            continue;
+
+        double avgUs = counter.totalTimestamps() / rate / counter.count();
+        double intensity = counter.getBytes() ? static_cast<double>(counter.getFlops()) / counter.getBytes() : 0;
+        // Operations per microsecond and bytes per nanosecond are GFLOP/s and GB/s
+        double gflops = avgUs > 0 ? counter.getFlops() / avgUs / 1000.0 : 0;
+        double gbytes = avgUs > 0 ? counter.getBytes() / avgUs / 1000.0 : 0;
+
+        roofline << (first ? "\n" : ",\n");
+        roofline << "{\"name\":" << jsonString(node->getName())
+                 << ",\"type\":" << jsonString(node->getTypeStr())
+                 << ",\"exec_type\":" << jsonString(node->getPrimitiveDescriptorType())
+                 << ",\"count\":" << counter.count()
+                 << ",\"avg_us\":" << avgUs
+                 << ",\"p50_us\":" << percentile(counter, 0.5, rate)
+                 << ",\"p90_us\":" << percentile(counter, 0.9, rate)
+                 << ",\"p99_us\":" << percentile(counter, 0.99, rate)
+                 << ",\"bytes\":" << counter.getBytes()
+                 << ",\"flops\":" << counter.getFlops()
+                 << ",\"flops_per_byte\":" << intensity
+                 << ",\"gflops_per_s\":" << gflops
+                 << ",\"gbytes_per_s\":" << gbytes
+                 << ",\"histogram\":[";
+        auto &hist = counter.histogram();
+        for (size_t b = 0; b < hist.size(); b++)
+            roofline << (b ? "," : "") << hist[b];
+        roofline << "]}";
+        first = false;
+    }
+    roofline << "\n]}\n";
+}
+
+}  // namespace MKLDNNPlugin
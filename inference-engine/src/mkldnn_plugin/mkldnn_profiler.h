@@ -0,0 +1,27 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_graph.h"
+
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Starts recording of the node executions into the trace and estimates bytes moved and operations
+ * done by every node from its edges and weights. Should be called before the nodes cleanup, while the
+ * original layers are available.
+ */
+void enableProfiling(MKLDNNGraph &graph);
+
+/**
+ * @brief Writes `<prefix>_<network_name>_<graph_id>_trace.json` with the recorded node executions in the chrome
+ * trace format and `<prefix>_<network_name>_<graph_id>_roofline.json` with the latency distribution, the workload
+ * and the achieved throughput of every node. The network name is reduced to the characters valid in a file name.
+ */
+void dumpProfilingReport(const MKLDNNGraph &graph, const std::string &prefix);
+
+}  // namespace MKLDNNPlugin
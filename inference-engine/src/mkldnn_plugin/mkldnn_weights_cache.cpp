@@ -5,15 +5,190 @@
 #include "mkldnn_weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <cpu_isa_traits.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <memory>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace MKLDNNPlugin {
 
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
+namespace {
+
+/**
+ * Every persistent file starts with this header. The payload follows it at the page aligned offset
+ * headerSize, so it can be mapped as is.
+ */
+struct PersistentHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t headerSize;
+    uint64_t payloadSize;
+    uint64_t payloadCRC;
+    // build number and ISA of the writer, the layouts and the paddings of the weights depend on both of them
+    char stamp[112];
+};
+
+const char persistentMagic[8] = {'I', 'E', 'C', 'P', 'U', 'W', 'C', '\0'};
+const uint32_t persistentVersion = 1;
+const uint32_t persistentHeaderSize = 4096;
+
+std::string persistentStamp() {
+    using namespace mkldnn::impl::cpu;
+    std::string stamp;
+#ifdef CI_BUILD_NUMBER
+    stamp = CI_BUILD_NUMBER;
+#endif
+    stamp += mayiuse(avx512_core) ? "_avx512_core" :
+             mayiuse(avx512_common) ? "_avx512_common" :
+             mayiuse(avx2) ? "_avx2" :
+             mayiuse(sse42) ? "_sse42" : "_ref";
+    return stamp.substr(0, sizeof(PersistentHeader::stamp) - 1);
+}
+
+PersistentHeader makeHeader(const MKLDNNMemory& memory) {
+    PersistentHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, persistentMagic, sizeof(persistentMagic));
+    header.version = persistentVersion;
+    header.headerSize = persistentHeaderSize;
+    header.payloadSize = memory.GetSize();
+    header.payloadCRC = MKLDNNWeightsSharing::GetHashFunc().hash(static_cast<const unsigned char*>(memory.GetData()),
+                                                                 memory.GetSize());
+    const auto stamp = persistentStamp();
+    std::memcpy(header.stamp, stamp.c_str(), stamp.size());
+    return header;
+}
+
+MKLDNNMemoryPtr mapPersistent(const std::string& path, const MKLDNNMemoryDesc& desc, const mkldnn::engine& eng) {
+#ifndef _WIN32
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return nullptr;
+
+    // a file written by another build, another ISA or a crashed writer is not mapped and gets rewritten
+    PersistentHeader header;
+    struct stat st;
+    if (read(fd, &header, sizeof(header)) != static_cast<ssize_t>(sizeof(header)) ||
+        std::memcmp(header.magic, persistentMagic, sizeof(persistentMagic)) != 0 ||
+        header.version != persistentVersion ||
+        header.headerSize != persistentHeaderSize ||
+        header.stamp[sizeof(header.stamp) - 1] != '\0' ||
+        persistentStamp() != header.stamp ||
+        fstat(fd, &st) != 0 ||
+        static_cast<uint64_t>(st.st_size) != header.headerSize + header.payloadSize) {
+        close(fd);
+        return nullptr;
+    }
+    const size_t size = static_cast<size_t>(st.st_size);
+    void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return nullptr;
+
+    // the mapping lives as long as the memory object referring to it
+    MKLDNNMemoryPtr ptr(new MKLDNNMemory(eng), [data, size](MKLDNNMemory* memory) {
+        delete memory;
+        munmap(data, size);
+    });
+    auto payload = static_cast<unsigned char*>(data) + header.headerSize;
+    // the mapping is read-only, so the pads are not zeroed (they were zeroed by the writer)
+    ptr->Create(desc, payload, false);
+    if (ptr->GetSize() != header.payloadSize ||
+        MKLDNNWeightsSharing::GetHashFunc().hash(payload, header.payloadSize) != header.payloadCRC)
+        return nullptr;
+
+    return ptr;
+#else
+    return nullptr;
+#endif
+}
+
+void storePersistent(const std::string& path, const MKLDNNMemory& memory) {
+#ifndef _WIN32
+    // the file gets its name only when it is complete, so the other processes never map a partial file
+    const std::string tmpPath = path + "." + std::to_string(getpid()) + ".tmp";
+    {
+        std::ofstream out(tmpPath, std::ios::binary);
+        if (!out.is_open())
+            return;
+        const auto header = makeHeader(memory);
+        const std::vector<char> padding(header.headerSize - sizeof(header), 0);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(padding.data(), padding.size());
+        out.write(static_cast<const char*>(memory.GetData()), memory.GetSize());
+        if (!out.good()) {
+            out.close();
+            std::remove(tmpPath.c_str());
+            return;
+        }
+    }
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0)
+        std::remove(tmpPath.c_str());
+#endif
+}
+
+}  // namespace
+
+MKLDNNMemoryPtr MKLDNNWeightsSharing::findOrCreate(const std::string& name_hash, const MKLDNNMemoryDesc& desc,
+                                                   const mkldnn::engine& eng, std::function<MKLDNNMemoryPtr(void)> create) {
+    std::string dir;
+    {
+        std::unique_lock<std::mutex> lock(guard);
+        dir = persistentDir;
+    }
+    // winograd weights have no plain memory layout to be mapped
+    if (dir.empty() || desc.getFormat() == mkldnn::memory::wino_fmt)
+        return findOrCreate(name_hash, create);
+
+    return findOrCreate(name_hash, [&] () {
+        // the pages of the file are local to the numa node of the process that wrote it
+        const std::string path = dir + "/" + name_hash + "_numa" + std::to_string(numaNodeId) + ".blob";
+
+        MKLDNNMemoryPtr ptr = mapPersistent(path, desc, eng);
+        if (!ptr) {
+            ptr = create();
+            storePersistent(path, *ptr);
+        }
+        return ptr;
+    });
+}
+
+std::string MKLDNNWeightsSharing::GetKey(const void* data, size_t size, const MKLDNNMemoryDesc& desc) {
+    const auto md = static_cast<mkldnn::memory::desc>(desc).data;
+
+    std::string key = std::to_string(size) + "_" +
+                      std::to_string(simpleCRC.hash(static_cast<const unsigned char*>(data), size)) + "_" +
+                      std::to_string(md.format) + "_" + std::to_string(md.data_type);
+    for (int i = 0; i < md.ndims; i++)
+        key += "_" + std::to_string(md.dims[i]);
+
+    // blocked descriptors without a name are told apart by the blocking itself
+    if (md.format == mkldnn_blocked) {
+        const auto& blk = md.layout_desc.blocking;
+        for (int i = 0; i < md.ndims; i++) {
+            key += "_" + std::to_string(blk.block_dims[i]) + "x" + std::to_string(blk.strides[0][i]) +
+                   "x" + std::to_string(blk.padding_dims[i]);
+        }
+    }
+
+    return key;
+}
+
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
-        _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
+        _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>(numa_id);
 }
 
 MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
@@ -30,4 +205,10 @@ const MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const
     return found->second;
 }
 
+void NumaNodesWeights::setPersistentDir(const std::string& dir) {
+    persistentDir = dir;
+    for (auto& cache : _cache_map)
+        cache.second->setPersistentDir(dir);
+}
+
 }  // namespace MKLDNNPlugin
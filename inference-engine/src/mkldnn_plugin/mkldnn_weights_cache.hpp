@@ -49,11 +49,24 @@ protected:
  * Caching store of MKLDNNMemory objects
  * Will return a cached object or create new one
  *
+ * The store is owned by the plugin, so all executable networks loaded to it share the objects. A graph
+ * executed by a single stream uses the store only if the persistent directory is set. If the
+ * persistent directory is set, the objects created with a descriptor are also saved there and other
+ * processes map them read-only instead of creating them again. A file is mapped only if its header
+ * matches the build and the ISA of the process and the CRC of its payload is valid.
+ *
+ * There is no eviction: the files stay in the directory until the user removes them, the objects
+ * of the process are released with the last graph referring to them.
+ *
  * Is a thread safe
  */
 class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
+
+    MKLDNNWeightsSharing() = default;
+    explicit MKLDNNWeightsSharing(int numaId) : numaNodeId(numaId) {}
+
     MKLDNNMemoryPtr findOrCreate(const std::string& name_hash,
                              std::function<MKLDNNMemoryPtr(void)> create) {
         std::unique_lock<std::mutex> lock(guard);
@@ -66,11 +79,32 @@ public:
         }
         return ptr;
     }
+
+    /**
+     * Same as above, the created object has to have the given descriptor
+     * and is stored to the persistent directory if it is set
+     */
+    MKLDNNMemoryPtr findOrCreate(const std::string& name_hash, const MKLDNNMemoryDesc& desc,
+                                 const mkldnn::engine& eng, std::function<MKLDNNMemoryPtr(void)> create);
+
+    void setPersistentDir(const std::string& dir) {
+        std::unique_lock<std::mutex> lock(guard);
+        persistentDir = dir;
+    }
+
+    /**
+     * Key of the data reordered to the layout of the descriptor,
+     * it doesn't depend on the network and the layer the data belongs to
+     */
+    static std::string GetKey(const void* data, size_t size, const MKLDNNMemoryDesc& desc);
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
     std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> sharedWeights;
     std::mutex guard;
+    std::string persistentDir;
+    int numaNodeId = 0;
     static const SimpleDataHash simpleCRC;
 };
 
@@ -86,8 +120,15 @@ public:
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
 
+    /**
+     * Sets the directory to share the weights with other processes through, empty string switches it off
+     */
+    void setPersistentDir(const std::string& dir);
+    const std::string& getPersistentDir() const { return persistentDir; }
+
 private:
     std::map<int, MKLDNNWeightsSharing::Ptr> _cache_map;
+    std::string persistentDir;
 };
 
 }  // namespace MKLDNNPlugin
@@ -7,6 +7,7 @@
 #include <ie_iextension.h>
 #include "ie_util_internal.hpp"
 #include "nodes/list.hpp"
+#include "nodes/common/post_ops.hpp"
 
 #include <string>
 #include <vector>
@@ -52,6 +53,17 @@ public:
         return OK;
     }
 
+    /**
+     * @brief Checks whether the implementation applies the fused element-wise operations to its FP32 output itself
+     */
+    virtual bool canFusePostOps() const {
+        return false;
+    }
+
+    void setPostOps(const PostOps& ops) {
+        postOps = ops;
+    }
+
 protected:
     enum class ConfLayout { ANY, PLN, BLK8, BLK16 };
 
@@ -151,6 +163,7 @@ protected:
     }
     std::string errorMsg;
     std::vector<LayerConfig> confs;
+    PostOps postOps;
 };
 
 template <class IMPL>
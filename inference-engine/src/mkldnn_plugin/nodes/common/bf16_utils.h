@@ -0,0 +1,29 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include "fp16_utils.h"
+
+typedef uint16_t ie_bf16;
+
+// BF16 keeps the upper 16 bits of F32: S EEEEEEEE MMMMMMM
+inline float bf16tof32(ie_bf16 x) {
+    return asfloat(static_cast<uint32_t>(x) << 16);
+}
+
+// Function to convert F32 into BF16 with round to nearest even
+inline ie_bf16 f32tobf16(float x) {
+    union {
+        float f;
+        uint32_t i;
+    } u;
+    u.f = x;
+    // keep NaN quiet, rounding could turn it into INF
+    if ((u.i & EXP_MASK_F32) == EXP_MASK_F32 && (u.i & 0x007FFFFFU))
+        return static_cast<ie_bf16>((u.i >> 16) | 0x0040U);
+    u.i += 0x7FFFU + ((u.i >> 16) & 1U);
+    return static_cast<ie_bf16>(u.i >> 16);
+}
@@ -0,0 +1,156 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_layouts.h>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * @brief Chain of element-wise operations (activations, scale-shifts, quantizations) fused into the output
+ * of an extension layer. The layer applies the chain to the output values right after they are computed,
+ * so the fused operations don't need another pass over the output tensor.
+ */
+class PostOps {
+public:
+    /**
+     * @brief Channels of a run of contiguous values: the value i belongs to the channel
+     * base + (start + i) % period, or to the channel base if the period is 0
+     */
+    struct Channels {
+        size_t base;
+        size_t start;
+        size_t period;
+    };
+
+    /**
+     * @brief Element-wise operation applied to a run of contiguous output values
+     */
+    using Op = std::function<void(float* data, size_t count, const Channels& channels)>;
+
+    PostOps() = default;
+
+    /**
+     * @brief Creates an empty chain for the output tensor of the given dense layout
+     */
+    explicit PostOps(const TensorDesc& desc) {
+        const auto& blk = desc.getBlockingDesc();
+        const auto& order = blk.getOrder();
+        const auto& blkDims = blk.getBlockDims();
+        const auto& strides = blk.getStrides();
+        if (desc.getDims().size() < 2)
+            return;
+
+        for (size_t i = 0; i < order.size(); i++) {
+            if (order[i] != 1) continue;
+            if (i == order.size() - 1 && channelStride != 0) {
+                // blocked layout like nChw8c: the channel block is the innermost dimension
+                innerBlock = blkDims[i];
+            } else {
+                channelStride = strides[i];
+                channelBlocks = blkDims[i];
+            }
+        }
+    }
+
+    void append(Op op) {
+        ops.push_back(std::move(op));
+    }
+
+    bool empty() const {
+        return ops.empty();
+    }
+
+    /**
+     * @brief Returns the number of channels including the padding of the channel blocks
+     */
+    size_t channels() const {
+        return channelBlocks * innerBlock;
+    }
+
+    /**
+     * @brief Expands per-channel parameters to channels() values, a single value is broadcasted
+     * and the padding channels repeat the last value
+     */
+    std::vector<float> perChannel(const std::vector<float>& values) const {
+        std::vector<float> expanded(channels(), values.empty() ? 0.f : values.back());
+        std::copy_n(values.begin(), (std::min)(values.size(), expanded.size()), expanded.begin());
+        return expanded;
+    }
+
+    /**
+     * @brief Helper for the operations: replaces every value of the run with f(value, channel), the channel
+     * is constant within the inner loops so the per-channel parameters are loaded once per loop
+     */
+    template <typename F>
+    static void forEach(float* data, size_t count, const Channels& channels, F f) {
+        if (channels.period == 0) {
+            for (size_t i = 0; i < count; i++)
+                data[i] = f(data[i], channels.base);
+            return;
+        }
+
+        size_t start = channels.start;
+        while (count > 0) {
+            const size_t n = (std::min)(count, channels.period - start);
+            const size_t c = channels.base + start;
+            for (size_t i = 0; i < n; i++)
+                data[i] = f(data[i], c + i);
+            data += n;
+            count -= n;
+            start = 0;
+        }
+    }
+
+    /**
+     * @brief Applies the chain to the output values
+     * @param data Pointer to the first value
+     * @param count Number of values
+     * @param offset Offset of the first value from the beginning of the output tensor memory
+     */
+    void apply(float* data, size_t count, size_t offset) const {
+        if (ops.empty())
+            return;
+
+        while (count > 0) {
+            Channels channels = {0, 0, 0};
+            size_t run = count;
+            if (channelStride == 1) {
+                // channels are the innermost dimension (NHWC, NC): one run covers all the values
+                channels.start = offset % channelBlocks;
+                channels.period = channelBlocks;
+            } else if (channelStride != 0) {
+                // planar or blocked layout: a run ends with the spatial plane of a channel (block)
+                channels.base = ((offset / channelStride) % channelBlocks) * innerBlock;
+                if (innerBlock != 1) {
+                    channels.start = offset % innerBlock;
+                    channels.period = innerBlock;
+                }
+                run = (std::min)(count, channelStride - offset % channelStride);
+            }
+            for (const auto& op : ops)
+                op(data, run, channels);
+            data += run;
+            offset += run;
+            count -= run;
+        }
+    }
+
+private:
+    std::vector<Op> ops;
+    size_t channelStride = 0;
+    size_t channelBlocks = 1;
+    size_t innerBlock = 1;
+};
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,38 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * @brief Copies a slice whose size is known at compile time.
+ * The copy is inlined into one or a few scalar or vector moves, so gathering of many small slices
+ * (embedding lookups, token gathers) is not dominated by the call overhead.
+ */
+template <size_t N>
+struct FixedSliceCopy {
+    static inline void copy(uint8_t* dst, const uint8_t* src, size_t) {
+        std::memcpy(dst, src, N);
+    }
+};
+
+/**
+ * @brief Copies a slice of an arbitrary size
+ */
+struct AnySliceCopy {
+    static inline void copy(uint8_t* dst, const uint8_t* src, size_t len) {
+        std::memcpy(dst, src, len);
+    }
+};
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
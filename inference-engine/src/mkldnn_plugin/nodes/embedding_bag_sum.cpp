@@ -3,17 +3,106 @@
 //
 
 #include "embedding_bag_sum.hpp"
+#include "common/bf16_utils.h"
 #include "ie_parallel.hpp"
 #include "jit_generator.hpp"
 #include "list.hpp"
 
+#include <algorithm>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 using namespace InferenceEngine;
 using namespace InferenceEngine::Extensions::Cpu;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::utils;
 
+#define GET_OFF(field) offsetof(jit_emb_bag_call_args, field)
+
+// dst[i] += weight * src[i], prefetching the row which is accumulated next
+template <cpu_isa_t isa>
+struct jit_uni_emb_bag_kernel_f32 : public jit_uni_emb_bag_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_emb_bag_kernel_f32)
+
+    jit_uni_emb_bag_kernel_f32() : jit_uni_emb_bag_kernel(), jit_generator() {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_src_next, ptr[reg_params + GET_OFF(src_next)]);
+        mov(reg_weight, ptr[reg_params + GET_OFF(weight)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        uni_vbroadcastss(vmm_weight, ptr[reg_weight]);
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label exit_label;
+
+        int step = vlen / sizeof(float);
+        L(main_loop_label); {
+            cmp(reg_work_amount, step);
+            jl(tail_loop_label, T_NEAR);
+
+            prefetcht0(ptr[reg_src_next]);
+            uni_vmovups(vmm_src, ptr[reg_src]);
+            uni_vmovups(vmm_dst, ptr[reg_dst]);
+            uni_vfmadd231ps(vmm_dst, vmm_src, vmm_weight);
+            uni_vmovups(ptr[reg_dst], vmm_dst);
+
+            add(reg_src, step * sizeof(float));
+            add(reg_dst, step * sizeof(float));
+            add(reg_src_next, step * sizeof(float));
+            sub(reg_work_amount, step);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        step = 1;
+        L(tail_loop_label); {
+            cmp(reg_work_amount, step);
+            jl(exit_label, T_NEAR);
+
+            movss(xmm_src, ptr[reg_src]);
+            movss(xmm_dst, ptr[reg_dst]);
+            mulss(xmm_src, xmm_weight);
+            addss(xmm_dst, xmm_src);
+            movss(ptr[reg_dst], xmm_dst);
+
+            add(reg_src, step * sizeof(float));
+            add(reg_dst, step * sizeof(float));
+            sub(reg_work_amount, step);
+
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+
+        ker_ = (decltype(ker_))this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == sse42, Xbyak::Xmm, isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    size_t vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_src_next = r10;
+    Xbyak::Reg64 reg_weight = r11;
+    Xbyak::Reg64 reg_work_amount = r12;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_weight = Vmm(0);
+    Vmm vmm_src = Vmm(1);
+    Vmm vmm_dst = Vmm(2);
+    Xbyak::Xmm xmm_weight = Xbyak::Xmm(0);
+    Xbyak::Xmm xmm_src = Xbyak::Xmm(1);
+    Xbyak::Xmm xmm_dst = Xbyak::Xmm(2);
+};
 
 const std::set<size_t> MKLDNNEmbeddingBagSum::_supportedIndicesTypeSize = {sizeof(INT32), sizeof(INT64)};
 
@@ -83,6 +172,10 @@ MKLDNNEmbeddingBagSum::MKLDNNEmbeddingBagSum(
         config.outConfs.push_back(outConfig);
         config.dynBatchSupport = false;
 
+        // BF16 embedding table is read as is and accumulated in FP32
+        if (inData->getTensorDesc().getPrecision() == Precision::BF16)
+            config.inConfs[0].desc.setPrecision(Precision::BF16);
+
         confs.push_back(config);
 
         const auto& inDataDims = inData->getTensorDesc().getDims();
@@ -90,6 +183,14 @@ MKLDNNEmbeddingBagSum::MKLDNNEmbeddingBagSum(
         for (size_t i = 1lu; i < inDataDims.size(); i++) {
             _embDepth *= inDataDims[i];
         }
+
+        if (mayiuse(avx512_common)) {
+            _rowKernel.reset(new jit_uni_emb_bag_kernel_f32<avx512_common>());
+        } else if (mayiuse(avx2)) {
+            _rowKernel.reset(new jit_uni_emb_bag_kernel_f32<avx2>());
+        } else if (mayiuse(sse42)) {
+            _rowKernel.reset(new jit_uni_emb_bag_kernel_f32<sse42>());
+        }
     } catch (InferenceEngine::details::InferenceEngineException &ex) {
         errorMsg = ex.what();
     }
@@ -99,108 +200,158 @@ StatusCode MKLDNNEmbeddingBagSum::execute(
             std::vector<Blob::Ptr>& inputs,
             std::vector<Blob::Ptr>& outputs,
             ResponseDesc *resp) noexcept {
-    switch (inputs[0]->getTensorDesc().getPrecision()) {
-        case Precision::FP32: {
-            processData<PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs);
-            break;
-        }
-        case Precision::I8: {
-            processData<PrecisionTrait<Precision::I8>::value_type>(inputs, outputs);
-            break;
-        }
-        case Precision::U8: {
-            processData<PrecisionTrait<Precision::U8>::value_type>(inputs, outputs);
-            break;
-        }
-        case Precision::I32: {
-            processData<PrecisionTrait<Precision::I32>::value_type>(inputs, outputs);
-            break;
-        }
-        default: {
-            if (resp) {
-                std::string errorMsg = "EmbeddingBagSum layer does not support precision '"
-                        + std::string(inputs[0]->getTensorDesc().getPrecision().name()) + "'";
-                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+    try {
+        switch (inputs[0]->getTensorDesc().getPrecision()) {
+            case Precision::FP32: {
+                processData<PrecisionTrait<Precision::FP32>::value_type, PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs);
+                break;
+            }
+            case Precision::BF16: {
+                processData<ie_bf16, PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs);
+                break;
             }
-            return GENERAL_ERROR;
+            case Precision::I8: {
+                processData<PrecisionTrait<Precision::I8>::value_type, PrecisionTrait<Precision::I8>::value_type>(inputs, outputs);
+                break;
+            }
+            case Precision::U8: {
+                processData<PrecisionTrait<Precision::U8>::value_type, PrecisionTrait<Precision::U8>::value_type>(inputs, outputs);
+                break;
+            }
+            case Precision::I32: {
+                processData<PrecisionTrait<Precision::I32>::value_type, PrecisionTrait<Precision::I32>::value_type>(inputs, outputs);
+                break;
+            }
+            default: {
+                if (resp) {
+                    std::string errorMsg = "EmbeddingBagSum layer does not support precision '"
+                            + std::string(inputs[0]->getTensorDesc().getPrecision().name()) + "'";
+                    errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+                }
+                return GENERAL_ERROR;
+            }
+        }
+    } catch (const std::exception& excp) {
+        if (resp) {
+            std::string errorMsg = excp.what();
+            errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
         }
+        return GENERAL_ERROR;
     }
 
     return OK;
 }
 
-template<typename T>
+void MKLDNNEmbeddingBagSum::accumulateRow(const float* src, const float* srcNext, const float& weight, float* dst) {
+    if (_rowKernel) {
+        auto arg = jit_emb_bag_call_args();
+        arg.src = src;
+        arg.dst = dst;
+        arg.src_next = srcNext;
+        arg.weight = &weight;
+        arg.work_amount = _embDepth;
+        (*_rowKernel)(&arg);
+    } else {
+        for (size_t i = 0lu; i < _embDepth; i++) {
+            dst[i] += src[i] * weight;
+        }
+    }
+}
+
+namespace {
+
+template<typename S, typename A>
+inline A cvtToAcc(const S& value) {
+    return static_cast<A>(value);
+}
+
+template<>
+inline float cvtToAcc<ie_bf16, float>(const ie_bf16& value) {
+    return bf16tof32(value);
+}
+
+}  // namespace
+
+template<typename S, typename A>
+void MKLDNNEmbeddingBagSum::accumulateRow(const S* src, const S* srcNext, const A& weight, A* dst) {
+    for (size_t i = 0lu; i < _embDepth; i++) {
+        dst[i] += cvtToAcc<S, A>(src[i]) * weight;
+    }
+}
+
+template<typename S, typename D>
 void MKLDNNEmbeddingBagSum::processData(
             std::vector<Blob::Ptr>& inputs,
-            std::vector<Blob::Ptr>& outputs) noexcept {
-    const T* srcData = inputs[0]->cbuffer().as<const T*>() +
+            std::vector<Blob::Ptr>& outputs) {
+    // Floating point tables (including BF16) are accumulated in FP32,
+    // integer tables in I32 with the same wrap around semantics as the reference
+    using A = typename std::conditional<std::is_floating_point<D>::value, float, int32_t>::type;
+
+    const S* srcData = inputs[0]->cbuffer().as<const S*>() +
         inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-    T* dstData = outputs[0]->buffer().as<T*>() +
+    D* dstData = outputs[0]->buffer().as<D*>() +
         outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-    const T* weightsData = nullptr;
+    const D* weightsData = nullptr;
     if (_withWeights)
-        weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const T*>();
+        weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const D*>();
     initFromInputs(inputs);
 
-    const auto& inDataDims = inputs[0]->getTensorDesc().getDims();
-
+    const size_t rowsNum = inputs[0]->getTensorDesc().getDims()[0];
     const size_t outputBagsNum = outputs[0]->getTensorDesc().getDims()[0];
 
+    // Collect bags and validate indices up front so that the parallel section does not throw
+    _bags.resize(outputBagsNum);
+    _workOffsets.resize(outputBagsNum + 1lu);
+    _workOffsets[0] = 0lu;
+    for (size_t obi = 0lu; obi < outputBagsNum; obi++) {
+        EmbeddingBag& bag = _bags[obi];
+        bag.withWeights = _withWeights;
+        getIndices(obi, bag.indices, bag.size, bag.weightsIdx, bag.withWeights);
+        bag.withWeights = bag.withWeights && _withWeights;
+        if (bag.indices == nullptr)
+            bag.size = 0lu;
+
+        for (size_t i = 0lu; i < bag.size; i++) {
+            if (bag.indices[i] >= rowsNum)
+                THROW_IE_EXCEPTION << "EmbeddingBagSum layer '" << _layerName
+                    << "' has invalid embedding bag index: " << bag.indices[i];
+        }
+        _workOffsets[obi + 1lu] = _workOffsets[obi] + std::max<size_t>(bag.size, 1lu);
+    }
+    const size_t totalWork = _workOffsets[outputBagsNum];
+
+    // Split by the number of gathered rows rather than by bags, pooling factors are usually skewed
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
+        splitter(totalWork, nthr, ithr, start, end);
         if (start >= end)
             return;
 
-        size_t indicesSize = 0lu;
-        const size_t* indices = nullptr;
-        size_t weightsIdx = 0lu;
-        bool withWeights = _withWeights;
-
-        for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
-
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
-
-                size_t inIdx = 0lu;
-                if (indices[inIdx] >= inDataDims[0])
-                    THROW_IE_EXCEPTION << "EmbeddingBagSum layer '" << _layerName
-                        << "' has invalid embedding bag index: " << indices[inIdx];
-                size_t srcIndex = indices[inIdx] * _embDepth;
-
-                if (withWeights) {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                    }
-                    weightsIdx++;
-                } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
-                }
+        // bag is processed by the thread which owns its first row
+        const auto offsetsEnd = _workOffsets.end() - 1;
+        const size_t bagsStart = std::lower_bound(_workOffsets.begin(), offsetsEnd, start) - _workOffsets.begin();
+        const size_t bagsEnd = std::lower_bound(_workOffsets.begin(), offsetsEnd, end) - _workOffsets.begin();
 
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (indices[inIdx] >= inDataDims[0])
-                        THROW_IE_EXCEPTION << "EmbeddingBagSum layer '" << _layerName
-                            << "' has invalid embedding bag index: " << indices[inIdx];
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
-                    }
-                }
-            } else {
+        std::vector<A> accBuffer;
+        if (!std::is_same<A, D>::value)
+            accBuffer.resize(_embDepth);
+
+        for (size_t obi = bagsStart; obi < bagsEnd; obi++) {
+            const EmbeddingBag& bag = _bags[obi];
+            D* dst = dstData + obi * _embDepth;
+            A* acc = std::is_same<A, D>::value ? reinterpret_cast<A*>(dst) : accBuffer.data();
+
+            std::fill_n(acc, _embDepth, static_cast<A>(0));
+            for (size_t i = 0lu; i < bag.size; i++) {
+                const S* row = srcData + bag.indices[i] * _embDepth;
+                const S* nextRow = i + 1lu < bag.size ? srcData + bag.indices[i + 1lu] * _embDepth : row;
+                const A weight = bag.withWeights ? static_cast<A>(weightsData[bag.weightsIdx + i]) : static_cast<A>(1);
+                accumulateRow(row, nextRow, weight, acc);
+            }
+
+            if (!std::is_same<A, D>::value) {
                 for (size_t i = 0lu; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
+                    dst[i] = static_cast<D>(acc[i]);
                 }
             }
         }
@@ -6,14 +6,33 @@
 
 #include "base.hpp"
 
+#include <cassert>
 #include <memory>
 #include <set>
+#include <string>
 #include <vector>
 
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+struct jit_emb_bag_call_args {
+    const float* src;
+    float* dst;
+    const float* src_next;
+    const float* weight;
+    size_t work_amount;
+};
+
+struct jit_uni_emb_bag_kernel {
+    void (*ker_)(const jit_emb_bag_call_args *);
+
+    void operator()(const jit_emb_bag_call_args *args) { assert(ker_); ker_(args); }
+
+    jit_uni_emb_bag_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_emb_bag_kernel() {}
+};
+
 class MKLDNNEmbeddingBagSum : public ExtLayerBase {
 public:
     MKLDNNEmbeddingBagSum(
@@ -38,8 +57,20 @@ protected:
         size_t& weightsIdx,
         bool& withWeights) = 0;
 
-    template<typename T>
-    void processData(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs) noexcept;
+    // Run of indices (and per-sample weights) reduced into one output bag
+    struct EmbeddingBag {
+        const size_t* indices = nullptr;
+        size_t size = 0lu;
+        size_t weightsIdx = 0lu;
+        bool withWeights = false;
+    };
+
+    template<typename S, typename D>
+    void processData(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs);
+
+    void accumulateRow(const float* src, const float* srcNext, const float& weight, float* dst);
+    template<typename S, typename A>
+    void accumulateRow(const S* src, const S* srcNext, const A& weight, A* dst);
 
     std::set<Precision> _supportedPrecisions;
 
@@ -51,6 +82,11 @@ protected:
     size_t _embDepth = 0;
     std::string _layerName;
 
+    std::vector<EmbeddingBag> _bags;
+    // _workOffsets[i] is the number of rows gathered by all bags before i, used to balance threads
+    std::vector<size_t> _workOffsets;
+    std::shared_ptr<jit_uni_emb_bag_kernel> _rowKernel;
+
     using INT32 = PrecisionTrait<Precision::I32>::value_type;
     using INT64 = PrecisionTrait<Precision::I64>::value_type;
     using UINT64 = PrecisionTrait<Precision::U64>::value_type;
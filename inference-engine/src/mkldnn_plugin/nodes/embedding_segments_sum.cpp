@@ -74,6 +74,18 @@ public:
             }
         }
 
+        // Segment ids are sorted, so every segment is a contiguous run of indices
+        _segmentsBegin.assign(_numSegments, 0lu);
+        _segmentsSize.assign(_numSegments, 0lu);
+        for (size_t si = 0; si < _segmentIds.size(); si++) {
+            const size_t segment = _segmentIds[si];
+            if (segment >= _numSegments)
+                continue;
+            if (_segmentsSize[segment] == 0lu)
+                _segmentsBegin[segment] = si;
+            _segmentsSize[segment]++;
+        }
+
         // Initialize default index
         _defaultIndices.clear();
         if (inputs.size() > DEFAULT_INDEX_IDX) {
@@ -92,19 +104,9 @@ public:
             THROW_IE_EXCEPTION << "Invalid embedding bag index.";
 
         indices = nullptr;
-        size = 0lu;
+        size = _segmentsSize[embIndex];
         withWeight = true;
 
-        for (size_t si = 0; si < _indices.size(); si++) {
-            if (_segmentIds[si] == embIndex) {
-                size++;
-                if (indices == nullptr) {
-                    indices = _indices.data() + si;
-                    weightsIdx = si;
-                }
-            }
-        }
-
         // Empty bag
         if (size == 0) {
             size = 1lu;
@@ -113,6 +115,9 @@ public:
                 indices = _defaultIndices.data();
             return;
         }
+
+        indices = _indices.data() + _segmentsBegin[embIndex];
+        weightsIdx = _segmentsBegin[embIndex];
     }
 
 protected:
@@ -124,6 +129,8 @@ protected:
     std::vector<size_t> _indices;
     std::vector<size_t> _segmentIds;
     std::vector<size_t> _defaultIndices;
+    std::vector<size_t> _segmentsBegin;
+    std::vector<size_t> _segmentsSize;
 };
 
 REG_FACTORY_FOR(EmbeddingSegmentsSumImpl, EmbeddingSegmentsSum);
@@ -11,7 +11,7 @@
 #include <algorithm>
 #include <limits>
 #include "ie_parallel.hpp"
-#include "common/simple_copy.h"
+#include "common/slice_copy.hpp"
 #include "common/fp16_utils.h"
 
 namespace InferenceEngine {
@@ -52,7 +52,7 @@ public:
 
             LayerConfig config;
             DataConfig dataConfigIdx, dataConfigDct;
-            Precision dataPrecision = layer->outData[0]->getTensorDesc().getPrecision();
+            dataPrecision = layer->outData[0]->getTensorDesc().getPrecision();
             dataConfigDct.desc = TensorDesc(dataPrecision, dictionary_dims,
                     layer->insData[GATHER_DICTIONARY].lock()->getTensorDesc().getLayoutByDims(dictionary_dims));
             config.inConfs.push_back(dataConfigDct);
@@ -73,34 +73,34 @@ public:
         }
     }
 
-    struct f32toUi32 {
-        inline unsigned int operator()(const float value) {
-            return static_cast<unsigned int>(value);
+    struct f32toI32 {
+        inline int operator()(const float value) {
+            return static_cast<int>(value);
         }
     };
 
-    struct f16toUi32 {
-        inline unsigned int operator()(const ie_fp16 value) {
-            return static_cast<unsigned int>(f16tof32(value));
+    struct f16toI32 {
+        inline int operator()(const ie_fp16 value) {
+            return static_cast<int>(f16tof32(value));
         }
     };
 
-    struct i32toUi32 {
-        inline unsigned int operator()(const int32_t value) {
-            return static_cast<unsigned int>(value);
+    struct i32toI32 {
+        inline int operator()(const int32_t value) {
+            return value;
         }
     };
 
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         switch (inputs[GATHER_INDEXES]->getTensorDesc().getPrecision()) {
             case Precision::FP32:
-                gather<float, f32toUi32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
+                gather<float, f32toI32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
                 break;
             case Precision::FP16:
-                gather<ie_fp16, f16toUi32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
+                gather<ie_fp16, f16toI32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
                 break;
             case Precision::I32:
-                gather<int32_t, i32toUi32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
+                gather<int32_t, i32toI32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
                 break;
             default:
                 return GENERAL_ERROR;
@@ -109,6 +109,10 @@ public:
         return OK;
     }
 
+    bool canFusePostOps() const override {
+        return dataPrecision == Precision::FP32;
+    }
+
 private:
     template <typename index_t, class Conversion>
     void gather(Blob::Ptr indexes, Blob::Ptr dictionary, Blob::Ptr output) {
@@ -116,24 +120,60 @@ private:
         const index_t *src_index = indexes->cbuffer().as<const index_t *>() + indexes->getTensorDesc().getBlockingDesc().getOffsetPadding();
         const uint8_t *src_dataDict = dictionary->cbuffer().as<const uint8_t *>() + dictionary->getTensorDesc().getBlockingDesc().getOffsetPadding();
         uint8_t *dst_data = output->cbuffer().as<uint8_t*>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
-        size_t len = dataLength * dictionary->getTensorDesc().getPrecision().size();
-
-        parallel_for(src_indexSize, [&](size_t i) {
-            unsigned int idx = Conversion()(src_index[i]);
+        size_t elemSize = dictionary->getTensorDesc().getPrecision().size();
+
+        //  Small slices are copied with inlined moves, larger ones with memcpy
+        switch (dataLength * elemSize) {
+            case 1:  gatherSlices<index_t, Conversion, FixedSliceCopy<1>>(src_index, src_indexSize, src_dataDict, dst_data, elemSize);  break;
+            case 2:  gatherSlices<index_t, Conversion, FixedSliceCopy<2>>(src_index, src_indexSize, src_dataDict, dst_data, elemSize);  break;
+            case 4:  gatherSlices<index_t, Conversion, FixedSliceCopy<4>>(src_index, src_indexSize, src_dataDict, dst_data, elemSize);  break;
+            case 8:  gatherSlices<index_t, Conversion, FixedSliceCopy<8>>(src_index, src_indexSize, src_dataDict, dst_data, elemSize);  break;
+            case 16: gatherSlices<index_t, Conversion, FixedSliceCopy<16>>(src_index, src_indexSize, src_dataDict, dst_data, elemSize); break;
+            case 32: gatherSlices<index_t, Conversion, FixedSliceCopy<32>>(src_index, src_indexSize, src_dataDict, dst_data, elemSize); break;
+            case 64: gatherSlices<index_t, Conversion, FixedSliceCopy<64>>(src_index, src_indexSize, src_dataDict, dst_data, elemSize); break;
+            default: gatherSlices<index_t, Conversion, AnySliceCopy>(src_index, src_indexSize, src_dataDict, dst_data, elemSize);       break;
+        }
+    }
 
+    template <typename index_t, class Conversion, class SliceCopy>
+    void gatherSlices(const index_t *src_index, size_t src_indexSize, const uint8_t *src_dataDict, uint8_t *dst_data, size_t elemSize) {
+        const size_t len = dataLength * elemSize;
+
+        //  Few large slices: every slice is split between threads as well, otherwise most of them stay idle
+        const size_t nWork = numDictionaries * src_indexSize;
+        const size_t nThreads = static_cast<size_t>(parallel_get_max_threads());
+        size_t nChunks = 1;
+        if (nWork < nThreads && len >= 2 * minChunkSize)
+            nChunks = (std::min)((nThreads + nWork - 1) / nWork, len / minChunkSize);
+        const size_t chunkLength = (dataLength + nChunks - 1) / nChunks;
+
+        parallel_for3d(numDictionaries, src_indexSize, nChunks, [&](size_t j, size_t i, size_t c) {
+            int idx = Conversion()(src_index[i]);
+            //  Negative indices count from the end of the axis
+            if (idx < 0)
+                idx += static_cast<int>(indexRange);
+
+            size_t start = c * chunkLength;
+            size_t count = (std::min)(chunkLength, dataLength - (std::min)(start, dataLength));
+            if (count == 0)
+                return;
+
+            uint8_t *dst = &dst_data[len * (i + j * src_indexSize) + start * elemSize];
             //  Index clipping
-            if (idx < indexRange) {
+            if (idx >= 0 && static_cast<size_t>(idx) < indexRange) {
                 //  Copying data to destination from Dictionary
-                for (size_t j = 0; j < numDictionaries; j++) {
-                    simple_copy(&dst_data[len * (i + j * src_indexSize)],
-                                output->byteSize() - (len * (i + j * src_indexSize)),
-                                &src_dataDict[len * (idx + j * indexRange)],
-                                len);
-                }
+                const uint8_t *src = &src_dataDict[len * (idx + j * indexRange) + start * elemSize];
+                if (nChunks == 1)
+                    SliceCopy::copy(dst, src, len);
+                else
+                    AnySliceCopy::copy(dst, src, count * elemSize);
             } else {
-                for (size_t j = 0; j < numDictionaries; j++) {
-                    memset(&dst_data[len * (i + j * src_indexSize)], 0, len);
-                }
+                memset(dst, 0, count * elemSize);
+            }
+
+            if (!postOps.empty()) {
+                size_t offset = dataLength * (i + j * src_indexSize) + start;
+                postOps.apply(reinterpret_cast<float*>(dst), count, offset);
             }
         });
     }
@@ -142,8 +182,11 @@ private:
     size_t numDictionaries = 1;
     size_t indexRange = 0;
     size_t dataLength = 1;
+    Precision dataPrecision;
     const size_t GATHER_DICTIONARY = 0;
     const size_t GATHER_INDEXES = 1;
+    //  Minimal part of a slice in bytes worth a separate task
+    const size_t minChunkSize = 4096;
 };
 
 
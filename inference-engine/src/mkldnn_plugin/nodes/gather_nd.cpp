@@ -0,0 +1,177 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "base.hpp"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "ie_parallel.hpp"
+#include "common/slice_copy.hpp"
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+class GatherNDImpl: public ExtLayerBase {
+public:
+    explicit GatherNDImpl(const CNNLayer* layer) {
+        try {
+            if (layer->insData.size() != 2 || layer->outData.size() != 1)
+                THROW_IE_EXCEPTION << layer->name << " Incorrect number of input/output edges!";
+
+            Precision inIdxPrecision = layer->insData[GATHER_ND_INDEXES].lock()->getTensorDesc().getPrecision();
+            if (inIdxPrecision != Precision::FP32 && inIdxPrecision != Precision::I32)
+                THROW_IE_EXCEPTION << layer->name << " Incorrect input precision. Only FP32 or I32 are supported!";
+
+            const SizeVector& data_dims = layer->insData[GATHER_ND_DATA].lock()->getTensorDesc().getDims();
+            const SizeVector& indexes_dims = layer->insData[GATHER_ND_INDEXES].lock()->getTensorDesc().getDims();
+            if (data_dims.empty() || indexes_dims.empty())
+                THROW_IE_EXCEPTION << layer->name << " Incorrect input parameters dimension!";
+
+            //  The last dimension of indices is the depth of a single index into data
+            indexDepth = indexes_dims.back();
+            if (indexDepth == 0 || indexDepth > data_dims.size())
+                THROW_IE_EXCEPTION << layer->name << " The last dimension of indices can be at most the rank of data!";
+
+            for (size_t i = indexDepth; i < data_dims.size(); i++)
+                sliceLength *= data_dims[i];
+            for (size_t i = 0; i < indexes_dims.size() - 1; i++)
+                numSlices *= indexes_dims[i];
+
+            dataDims = SizeVector(data_dims.begin(), data_dims.begin() + indexDepth);
+            dataStrides.resize(indexDepth);
+            size_t stride = sliceLength;
+            for (int i = static_cast<int>(indexDepth) - 1; i >= 0; i--) {
+                dataStrides[i] = stride;
+                stride *= data_dims[i];
+            }
+
+            LayerConfig config;
+            DataConfig dataConfigData, dataConfigIdx, dataConfigOut;
+            dataPrecision = layer->outData[0]->getTensorDesc().getPrecision();
+            dataConfigData.desc = TensorDesc(dataPrecision, data_dims,
+                    layer->insData[GATHER_ND_DATA].lock()->getTensorDesc().getLayoutByDims(data_dims));
+            config.inConfs.push_back(dataConfigData);
+            dataConfigIdx.desc = TensorDesc(inIdxPrecision, indexes_dims,
+                    layer->insData[GATHER_ND_INDEXES].lock()->getTensorDesc().getLayoutByDims(indexes_dims));
+            config.inConfs.push_back(dataConfigIdx);
+            const SizeVector& out_dims = layer->outData[0]->getTensorDesc().getDims();
+            dataConfigOut.desc = TensorDesc(dataPrecision, out_dims,
+                    layer->outData[0]->getTensorDesc().getLayoutByDims(out_dims));
+            config.outConfs.push_back(dataConfigOut);
+            config.dynBatchSupport = false;
+            confs.push_back(config);
+        } catch (InferenceEngine::details::InferenceEngineException &ex) {
+            errorMsg = ex.what();
+        }
+    }
+
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
+        switch (inputs[GATHER_ND_INDEXES]->getTensorDesc().getPrecision()) {
+            case Precision::FP32:
+                gatherND<float>(inputs[GATHER_ND_INDEXES], inputs[GATHER_ND_DATA], outputs[0]);
+                break;
+            case Precision::I32:
+                gatherND<int32_t>(inputs[GATHER_ND_INDEXES], inputs[GATHER_ND_DATA], outputs[0]);
+                break;
+            default:
+                return GENERAL_ERROR;
+        }
+
+        return OK;
+    }
+
+    bool canFusePostOps() const override {
+        return dataPrecision == Precision::FP32;
+    }
+
+private:
+    template <typename index_t>
+    void gatherND(Blob::Ptr indexes, Blob::Ptr data, Blob::Ptr output) {
+        const index_t *src_index = indexes->cbuffer().as<const index_t *>() + indexes->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        const uint8_t *src_data = data->cbuffer().as<const uint8_t *>() + data->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        uint8_t *dst_data = output->cbuffer().as<uint8_t*>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        size_t elemSize = data->getTensorDesc().getPrecision().size();
+
+        //  Small slices are copied with inlined moves, larger ones with memcpy
+        switch (sliceLength * elemSize) {
+            case 1:  gatherSlices<index_t, FixedSliceCopy<1>>(src_index, src_data, dst_data, elemSize);  break;
+            case 2:  gatherSlices<index_t, FixedSliceCopy<2>>(src_index, src_data, dst_data, elemSize);  break;
+            case 4:  gatherSlices<index_t, FixedSliceCopy<4>>(src_index, src_data, dst_data, elemSize);  break;
+            case 8:  gatherSlices<index_t, FixedSliceCopy<8>>(src_index, src_data, dst_data, elemSize);  break;
+            case 16: gatherSlices<index_t, FixedSliceCopy<16>>(src_index, src_data, dst_data, elemSize); break;
+            case 32: gatherSlices<index_t, FixedSliceCopy<32>>(src_index, src_data, dst_data, elemSize); break;
+            case 64: gatherSlices<index_t, FixedSliceCopy<64>>(src_index, src_data, dst_data, elemSize); break;
+            default: gatherSlices<index_t, AnySliceCopy>(src_index, src_data, dst_data, elemSize);       break;
+        }
+    }
+
+    template <typename index_t, class SliceCopy>
+    void gatherSlices(const index_t *src_index, const uint8_t *src_data, uint8_t *dst_data, size_t elemSize) {
+        const size_t len = sliceLength * elemSize;
+
+        //  Few large slices: every slice is split between threads as well, otherwise most of them stay idle
+        const size_t nThreads = static_cast<size_t>(parallel_get_max_threads());
+        size_t nChunks = 1;
+        if (numSlices < nThreads && len >= 2 * minChunkSize)
+            nChunks = (std::min)((nThreads + numSlices - 1) / numSlices, len / minChunkSize);
+        const size_t chunkLength = (sliceLength + nChunks - 1) / nChunks;
+
+        parallel_for2d(numSlices, nChunks, [&](size_t i, size_t c) {
+            size_t start = c * chunkLength;
+            size_t count = (std::min)(chunkLength, sliceLength - (std::min)(start, sliceLength));
+            if (count == 0)
+                return;
+
+            //  Offset of the slice in data, out of range indices give a zero slice
+            const index_t *index = &src_index[i * indexDepth];
+            bool inRange = true;
+            size_t offset = 0;
+            for (size_t d = 0; d < indexDepth; d++) {
+                int idx = static_cast<int>(index[d]);
+                //  Negative indices count from the end of the dimension
+                if (idx < 0)
+                    idx += static_cast<int>(dataDims[d]);
+                if (idx < 0 || static_cast<size_t>(idx) >= dataDims[d]) {
+                    inRange = false;
+                    break;
+                }
+                offset += idx * dataStrides[d];
+            }
+
+            uint8_t *dst = &dst_data[len * i + start * elemSize];
+            if (inRange) {
+                const uint8_t *src = &src_data[(offset + start) * elemSize];
+                if (nChunks == 1)
+                    SliceCopy::copy(dst, src, len);
+                else
+                    AnySliceCopy::copy(dst, src, count * elemSize);
+            } else {
+                memset(dst, 0, count * elemSize);
+            }
+
+            if (!postOps.empty())
+                postOps.apply(reinterpret_cast<float*>(dst), count, sliceLength * i + start);
+        });
+    }
+
+    size_t indexDepth = 0;
+    size_t sliceLength = 1;
+    size_t numSlices = 1;
+    SizeVector dataDims;
+    SizeVector dataStrides;
+    Precision dataPrecision;
+    const size_t GATHER_ND_DATA = 0;
+    const size_t GATHER_ND_INDEXES = 1;
+    //  Minimal part of a slice in bytes worth a separate task
+    const size_t minChunkSize = 4096;
+};
+
+
+REG_FACTORY_FOR(GatherNDImpl, GatherND);
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -287,6 +287,11 @@ public:
         return OK;
     }
 
+    bool canFusePostOps() const override {
+        // the U8 input path writes an output of the undefined layout
+        return interp_kernel != nullptr;
+    }
+
 private:
     int pad_beg;
     int pad_end;
@@ -302,6 +307,7 @@ private:
             for (size_t i = 0; i < N * C * OH * OW; i++) {
                 dst[i] = src[i];
             }
+            postOps.apply(dst, N * C * OH * OW, 0);
             return;
         }
 
@@ -380,6 +386,9 @@ private:
                             }
                         }
                     }
+
+                    // the output row is still in cache, apply the fused operations right away
+                    postOps.apply(pdst_h, OW_pad * block_size, static_cast<size_t>(pdst_h - dst));
         });
     }
 
@@ -23,6 +23,7 @@ public:
     void createDescriptor(const std::vector<InferenceEngine::TensorDesc>& inputDesc,
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
     void createPrimitive() override;
+    bool isExecutedByPrimitive() const override { return true; }
     bool created() const override;
 
     mkldnn::algorithm getAlgorithm() const { return algorithm; }
@@ -22,6 +22,7 @@ public:
     void initOptimalPrimitiveDescriptor() override;
     void getSupportedDescriptors() override;
     void createPrimitive() override;
+    bool isExecutedByPrimitive() const override { return true; }
     bool created() const override;
 
     mkldnn::algorithm getAlgorithm() const { return algorithm; }
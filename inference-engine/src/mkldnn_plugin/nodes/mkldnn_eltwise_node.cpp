@@ -61,20 +61,32 @@ struct jit_uni_eltwise_fq_generic : public jit_uni_eltwise_fq_kernel, public jit
         if (isa == avx512_common)
             vpxord(vmm_zero, vmm_zero, vmm_zero);
 
-        if (jep.src0_step == 0)
-            uni_vbroadcastss(vmm_src0, ptr[reg_src0]);
-        if (jep.src1_step == 0)
-            uni_vbroadcastss(vmm_src1, ptr[reg_src1]);
+        if (jep.src0_step == 0) {
+            load_broadcast(vmm_src0, ptr[reg_src0], jep.src0_dt);
+            if (jep.with_src0_scale_shift)
+                apply_scale_shift(vmm_src0, GET_OFF(src0_scales), GET_OFF(src0_shifts), true, false);
+        }
+        if (jep.src1_step == 0) {
+            load_broadcast(vmm_src1, ptr[reg_src1], jep.src1_dt);
+            if (jep.with_src1_scale_shift)
+                apply_scale_shift(vmm_src1, GET_OFF(src1_scales), GET_OFF(src1_shifts), true, false);
+        }
 
         L(main_loop_label);
         {
             cmp(reg_work_amount, simd_w);
             jl(main_loop_end_label, T_NEAR);
 
-            if (jep.src0_step != 0)
+            if (jep.src0_step != 0) {
                 load_vector(vmm_src0, ptr[reg_src0], jep.src0_dt);
-            if (jep.src1_step != 0)
+                if (jep.with_src0_scale_shift)
+                    apply_scale_shift(vmm_src0, GET_OFF(src0_scales), GET_OFF(src0_shifts), false, false);
+            }
+            if (jep.src1_step != 0) {
                 load_vector(vmm_src1, ptr[reg_src1], jep.src1_dt);
+                if (jep.with_src1_scale_shift)
+                    apply_scale_shift(vmm_src1, GET_OFF(src1_scales), GET_OFF(src1_shifts), false, false);
+            }
 
             switch (jep.eltwise_op) {
                 case EltwiseLayer::eOperation::Sum:
@@ -141,10 +153,16 @@ struct jit_uni_eltwise_fq_generic : public jit_uni_eltwise_fq_kernel, public jit
             cmp(reg_work_amount, 1);
             jl(tail_loop_end_label, T_NEAR);
 
-            if (jep.src0_step != 0)
+            if (jep.src0_step != 0) {
                 load_scalar(xmm_src0, ptr[reg_src0], jep.src0_dt);
-            if (jep.src1_step != 0)
+                if (jep.with_src0_scale_shift)
+                    apply_scale_shift(vmm_src0, GET_OFF(src0_scales), GET_OFF(src0_shifts), false, true);
+            }
+            if (jep.src1_step != 0) {
                 load_scalar(xmm_src1, ptr[reg_src1], jep.src1_dt);
+                if (jep.with_src1_scale_shift)
+                    apply_scale_shift(vmm_src1, GET_OFF(src1_scales), GET_OFF(src1_shifts), false, true);
+            }
 
             switch (jep.eltwise_op) {
                 case EltwiseLayer::eOperation::Sum: uni_vaddps(vmm_dst, vmm_src0, vmm_src1); break;
@@ -231,6 +249,9 @@ private:
 
     Vmm vmm_zero = Vmm(5);
 
+    Vmm vmm_scale = Vmm(6);
+    Vmm vmm_shift = Vmm(7);
+
     std::vector<std::shared_ptr<jit_uni_eltwise_injector_f32<isa>>> eltwise_injectors;
     std::vector<std::shared_ptr<jit_uni_quantization_injector_f32<isa>>> quantization_injectors;
 
@@ -255,6 +276,33 @@ private:
         }
     }
 
+    inline void load_broadcast(Vmm vmm_src, const Xbyak::Address &op, memory::data_type src_dt) {
+        if (src_dt == data_type::f32) {
+            uni_vbroadcastss(vmm_src, op);
+        } else {
+            Xmm xmm_src = Xmm(vmm_src.getIdx());
+            load_scalar(xmm_src, op, src_dt);
+            uni_vbroadcastss(vmm_src, xmm_src);
+        }
+    }
+
+    // Per channel values are addressed by reg_oc_off, a broadcasted input has a single channel
+    inline void load_channel_params(Vmm vmm, size_t params_off, bool is_broadcast, bool is_scalar) {
+        mov(reg_tmp_64, ptr[reg_params + params_off]);
+        if (is_broadcast)
+            uni_vbroadcastss(vmm, ptr[reg_tmp_64]);
+        else if (is_scalar)
+            movss(Xmm(vmm.getIdx()), ptr[reg_tmp_64 + reg_oc_off]);
+        else
+            uni_vmovups(vmm, ptr[reg_tmp_64 + reg_oc_off]);
+    }
+
+    inline void apply_scale_shift(Vmm vmm_src, size_t scales_off, size_t shifts_off, bool is_broadcast, bool is_scalar) {
+        load_channel_params(vmm_scale, scales_off, is_broadcast, is_scalar);
+        load_channel_params(vmm_shift, shifts_off, is_broadcast, is_scalar);
+        uni_vfmadd213ps(vmm_src, vmm_scale, vmm_shift);
+    }
+
     inline void load_scalar(Xmm xmm_src, const Xbyak::Address &op, memory::data_type src_dt) {
         switch (src_dt) {
             case memory::f32:
@@ -381,6 +429,35 @@ bool MKLDNNEltwiseNode::isUnitScales() {
     return true;
 }
 
+void MKLDNNEltwiseNode::fuseInputScaleShift(size_t input, Precision precision,
+                                            std::vector<float> scales, std::vector<float> shifts) {
+    if (input > 1)
+        THROW_IE_EXCEPTION << "Eltwise node " << getName() << " supports scale and shift only for the first two inputs";
+    if (scales.size() != shifts.size())
+        THROW_IE_EXCEPTION << "Eltwise node " << getName() << " got different number of scales and shifts for input " << input;
+
+    inputPrecisions.resize(2, Precision::UNSPECIFIED);
+    inputScales.resize(2);
+    inputShifts.resize(2);
+
+    // The kernel reads per channel values by whole vectors
+    size_t paddedSize = rnd_up(scales.size(), 16);
+    scales.resize(paddedSize, 0.f);
+    shifts.resize(paddedSize, 0.f);
+
+    inputPrecisions[input] = precision;
+    inputScales[input] = std::move(scales);
+    inputShifts[input] = std::move(shifts);
+}
+
+bool MKLDNNEltwiseNode::withInputScaleShift(size_t input) const {
+    return input < inputScales.size() && !inputScales[input].empty();
+}
+
+bool MKLDNNEltwiseNode::withJitKernel() const {
+    return !fusedWith.empty() || withInputScaleShift(0) || withInputScaleShift(1);
+}
+
 bool MKLDNNEltwiseNode::isWithBroadcast() {
     bool withBroadcast = false;
     auto oDims = outDims[0].ToSizeVector();
@@ -491,7 +568,7 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
         return {config, impl_type, format};
     };
 
-    if (fusedWith.empty()) {
+    if (!withJitKernel()) {
         for (const auto& format : getAvailableFormatsForDims(getChildEdgeAt(0)->getDims())) {
             // Precision of implementation is defined by precision of output tensor
             auto prec = getCnnLayer()->outData[0]->getPrecision();
@@ -535,16 +612,19 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
             InferenceEngine::DataConfig dataConfig;
             dataConfig.inPlace = -1;
             dataConfig.constant = false;
-            auto inputDT = MKLDNNExtensionUtils::IEPrecisionToDataType(
-                    getCnnLayer()->insData[i].lock()->getPrecision());
+            // Inputs with folded scale and shift are read before their dequantization
+            auto inputPrecision = withInputScaleShift(i) ? inputPrecisions[i] : getCnnLayer()->insData[i].lock()->getPrecision();
+            auto inputDT = MKLDNNExtensionUtils::IEPrecisionToDataType(inputPrecision);
             dataConfig.desc = MKLDNNMemoryDesc(getParentEdgeAt(i)->getDims(), inputDT, format);
             config.inConfs.push_back(dataConfig);
         }
 
         auto outputDT = memory::f32;
-        auto lastFusedLayer = fusedWith[fusedWith.size() - 1].get()->getCnnLayer();
+        auto lastFusedLayer = fusedWith.empty() ? getCnnLayer() : fusedWith[fusedWith.size() - 1].get()->getCnnLayer();
         if (lastFusedLayer) {
             outputDT = MKLDNNExtensionUtils::IEPrecisionToDataType(lastFusedLayer->outData[0]->getPrecision());
+            if (outputDT == memory::bf16)
+                outputDT = memory::f32;
         }
 
         InferenceEngine::DataConfig dataConfig;
@@ -564,6 +644,8 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
         jep.src0_data_size = MKLDNNExtensionUtils::sizeOfDataType(jep.src0_dt);
         jep.src1_data_size = MKLDNNExtensionUtils::sizeOfDataType(jep.src1_dt);
         jep.dst_data_size = MKLDNNExtensionUtils::sizeOfDataType(jep.dst_dt);
+        jep.with_src0_scale_shift = withInputScaleShift(0);
+        jep.with_src1_scale_shift = withInputScaleShift(1);
         jep.eltwise_op = op;
 
         if (mayiuse(cpu::avx512_common)) {
@@ -600,7 +682,7 @@ void MKLDNNEltwiseNode::createPrimitive() {
             srcs_p.emplace_back(srcMemPtr->GetPrimitive());
         }
     }
-    if (op == EltwiseLayer::Sum && !broadcast && fusedWith.empty()) {
+    if (op == EltwiseLayer::Sum && !broadcast && !withJitKernel()) {
         try {
             auto primitive_desc = mkldnn::sum::primitive_desc(dstMemPtr->GetDescriptor(), sum_scales, srcs_pd);
             prim = std::shared_ptr<mkldnn::sum>(new mkldnn::sum(primitive_desc, srcs_p, dstMemPtr->GetPrimitive()));
@@ -2533,6 +2615,10 @@ void MKLDNNEltwiseNode::jit_eltwise_fq() {
     const uint8_t *src1_ptr = reinterpret_cast<const uint8_t*>(srcMemory1.GetData()) +
         srcMemory1.GetDescriptor().data.layout_desc.blocking.offset_padding *
         MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(srcMemory1.GetDescriptor().data.data_type));
+    const float *src0_scales = withInputScaleShift(0) ? &inputScales[0][0] : nullptr;
+    const float *src0_shifts = withInputScaleShift(0) ? &inputShifts[0][0] : nullptr;
+    const float *src1_scales = withInputScaleShift(1) ? &inputScales[1][0] : nullptr;
+    const float *src1_shifts = withInputScaleShift(1) ? &inputShifts[1][0] : nullptr;
     uint8_t *dst_ptr = reinterpret_cast<uint8_t*>(dstMemory.GetData()) +
         dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding *
         MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(dstMemory.GetDescriptor().data.data_type));
@@ -2554,6 +2640,10 @@ void MKLDNNEltwiseNode::jit_eltwise_fq() {
             arg.src1 = src1_ptr + off * jep.src1_data_size;
             arg.dst = dst_ptr + off * jep.dst_data_size;
             arg.work_amount = static_cast<size_t>(C);
+            arg.src0_scales = src0_scales;
+            arg.src0_shifts = src0_shifts;
+            arg.src1_scales = src1_scales;
+            arg.src1_shifts = src1_shifts;
 
             (*eltiwse_fq_kernel)(&arg);
         });
@@ -2580,6 +2670,10 @@ void MKLDNNEltwiseNode::jit_eltwise_fq() {
             arg.src1 = src1_ptr + index_in1 * jep.src1_data_size;
             arg.dst = dst_ptr + index_out * jep.dst_data_size;
             arg.work_amount = static_cast<size_t>(dims_out[4]);
+            arg.src0_scales = src0_scales;
+            arg.src0_shifts = src0_shifts;
+            arg.src1_scales = src1_scales;
+            arg.src1_shifts = src1_shifts;
 
             (*eltiwse_fq_kernel)(&arg);
         });
@@ -2627,7 +2721,7 @@ void MKLDNNEltwiseNode::execute(mkldnn::stream strm) {
 
         IE_ASSERT(getParentEdges().size() > 1);
 
-        if (!fusedWith.empty()) {
+        if (withJitKernel()) {
             jit_eltwise_fq();
         } else {
             // Input and output types for eltwise compare operations can be different
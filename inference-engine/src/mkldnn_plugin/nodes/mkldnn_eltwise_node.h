@@ -23,6 +23,8 @@ struct jit_eltwise_fq_params {
     int src0_data_size;
     int src1_data_size;
     int dst_data_size;
+    bool with_src0_scale_shift;
+    bool with_src1_scale_shift;
 
     InferenceEngine::EltwiseLayer::eOperation eltwise_op;
 };
@@ -32,6 +34,10 @@ struct jit_eltwise_fq_call_args {
     const void *src1;
     void *dst;
     size_t work_amount;
+    const float *src0_scales;
+    const float *src0_shifts;
+    const float *src1_scales;
+    const float *src1_shifts;
 };
 
 struct jit_uni_eltwise_fq_kernel {
@@ -66,6 +72,11 @@ public:
     bool isWithBroadcast();
     void initOptimalPrimitiveDescriptor() override;
 
+    // Folds the dequantization of an INT8 input (x * scales[c] + shifts[c]) into the JIT kernel,
+    // so the input is read in its original precision
+    void fuseInputScaleShift(size_t input, InferenceEngine::Precision precision,
+                             std::vector<float> scales, std::vector<float> shifts);
+
 private:
     InferenceEngine::EltwiseLayer::eOperation op;
     std::vector<float> sum_scales;
@@ -74,9 +85,15 @@ private:
     std::vector<MKLDNNMemoryPtr> PostOpsIntBlobMemory;
     mkldnn::primitive_attr attr;
 
+    std::vector<InferenceEngine::Precision> inputPrecisions;
+    std::vector<std::vector<float>> inputScales;
+    std::vector<std::vector<float>> inputShifts;
+
     std::shared_ptr<jit_uni_eltwise_fq_kernel> eltiwse_fq_kernel;
     jit_eltwise_fq_params jep;
 
+    bool withJitKernel() const;
+    bool withInputScaleShift(size_t input) const;
     void jit_eltwise_fq();
     void setPostOps(mkldnn::primitive_attr &attr, bool initWeights);
 
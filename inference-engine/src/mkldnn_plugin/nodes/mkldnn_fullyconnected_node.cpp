@@ -12,10 +12,141 @@
 #include <vector>
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
+#include <mkldnn_types.h>
+#include "ie_parallel.hpp"
+#include "common/bf16_utils.h"
+#include "jit_generator.hpp"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_fc_compressed_call_args, field)
+
+// Computes rows x oc_unroll vectors of output channels. The weights are packed as [ic][oc_unroll * simd_w] and
+// converted to FP32 in registers right after the load, so only the compressed values are read from the memory.
+template <cpu_isa_t isa>
+struct jit_uni_fc_compressed_kernel_f32 : public jit_uni_fc_compressed_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_fc_compressed_kernel_f32)
+
+    explicit jit_uni_fc_compressed_kernel_f32(jit_fc_compressed_config_params jcp) : jit_uni_fc_compressed_kernel(jcp), jit_generator() {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_src_stride, ptr[reg_params + GET_OFF(src_stride)]);
+        mov(reg_dst_stride, ptr[reg_params + GET_OFF(dst_stride)]);
+        mov(reg_ic, ptr[reg_params + GET_OFF(ic)]);
+        lea(reg_src_stride3, ptr[reg_src_stride + reg_src_stride * 2]);
+
+        for (int r = 0; r < jcp_.rows; r++) {
+            for (int u = 0; u < jcp_.oc_unroll; u++) {
+                uni_vpxor(vmm_acc(r, u), vmm_acc(r, u), vmm_acc(r, u));
+            }
+        }
+
+        Xbyak::Label ic_loop_label;
+        L(ic_loop_label);
+        {
+            for (int u = 0; u < jcp_.oc_unroll; u++) {
+                load_weights(vmm_weights(u), ptr[reg_weights + u * simd_w * jcp_.wei_data_size]);
+            }
+
+            for (int r = 0; r < jcp_.rows; r++) {
+                uni_vbroadcastss(vmm_src, src_ptr(r));
+                for (int u = 0; u < jcp_.oc_unroll; u++) {
+                    uni_vfmadd231ps(vmm_acc(r, u), vmm_weights(u), vmm_src);
+                }
+            }
+
+            add(reg_src, sizeof(float));
+            add(reg_weights, jcp_.oc_unroll * simd_w * jcp_.wei_data_size);
+            sub(reg_ic, 1);
+            jnz(ic_loop_label, T_NEAR);
+        }
+
+        // dst = acc * scale + bias
+        mov(reg_scales, ptr[reg_params + GET_OFF(scales)]);
+        mov(reg_biases, ptr[reg_params + GET_OFF(biases)]);
+        for (int u = 0; u < jcp_.oc_unroll; u++) {
+            uni_vmovups(vmm_weights(u), ptr[reg_scales + u * vlen]);
+            uni_vmovups(vmm_src, ptr[reg_biases + u * vlen]);
+            for (int r = 0; r < jcp_.rows; r++) {
+                vfmadd213ps(vmm_acc(r, u), vmm_weights(u), vmm_src);
+            }
+        }
+
+        for (int r = 0; r < jcp_.rows; r++) {
+            for (int u = 0; u < jcp_.oc_unroll; u++) {
+                uni_vmovups(ptr[reg_dst + u * vlen], vmm_acc(r, u));
+            }
+            add(reg_dst, reg_dst_stride);
+        }
+
+        this->postamble();
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::sse42, Xbyak::Xmm, isa == cpu::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_weights = r9;
+    Xbyak::Reg64 reg_dst = r10;
+    Xbyak::Reg64 reg_src_stride = r11;
+    Xbyak::Reg64 reg_src_stride3 = r12;
+    Xbyak::Reg64 reg_dst_stride = r13;
+    Xbyak::Reg64 reg_ic = r14;
+    Xbyak::Reg64 reg_scales = r15;
+    Xbyak::Reg64 reg_biases = rbp;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    inline Vmm vmm_acc(int r, int u) {
+        return Vmm(r * jcp_.oc_unroll + u);
+    }
+
+    inline Vmm vmm_weights(int u) {
+        return Vmm(jcp_.rows * jcp_.oc_unroll + u);
+    }
+
+    Vmm vmm_src = Vmm(jcp_.rows * jcp_.oc_unroll + jcp_.oc_unroll);
+
+    inline Xbyak::Address src_ptr(int r) {
+        switch (r) {
+            case 0: return ptr[reg_src];
+            case 1: return ptr[reg_src + reg_src_stride];
+            case 2: return ptr[reg_src + reg_src_stride * 2];
+            default: return ptr[reg_src + reg_src_stride3];
+        }
+    }
+
+    inline void load_weights(Vmm vmm_dst, const Xbyak::Address &op) {
+        switch (jcp_.wei_dt) {
+            case memory::s8:
+                uni_vpmovsxbd(vmm_dst, op);
+                uni_vcvtdq2ps(vmm_dst, vmm_dst);
+                break;
+            case memory::bf16:
+                // BF16 keeps the upper half of FP32
+                vpmovzxwd(vmm_dst, op);
+                vpslld(vmm_dst, vmm_dst, 16);
+                break;
+            default:
+                assert(!"unknown wei_dt");
+        }
+    }
+};
 
 MKLDNNFullyConnectedNode::MKLDNNFullyConnectedNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
         : MKLDNNNode(layer, eng, cache), withBiases(false), baseInputsNumber(0) {
@@ -157,6 +288,13 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
         }
     }
 
+    auto compression = getCnnLayer()->params.find("weights_compression");
+    if (compression != getCnnLayer()->params.end() && baseInputsNumber == 1 && wScale == nullptr &&
+            inputDataType == memory::f32 && outputDataType == memory::f32 &&
+            internalBlobs[0]->getTensorDesc().getPrecision() == Precision::FP32) {
+        weightsCompression = Precision::FromStr(compression->second);
+    }
+
     for (auto format : getAvailableFormatsForDims(getParentEdgeAt(0)->getDims())) {
         MKLDNNMemoryDesc in_candidate(inDims, inputDataType, format);
         MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), outputDataType, memory::any);
@@ -165,7 +303,74 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    Precision outputPrecision = getCnnLayer()->outData[0]->getPrecision();
+    if (!fusedWith.empty()) {
+        auto lastFusedLayer = fusedWith[fusedWith.size() - 1].get()->getCnnLayer();
+        if (lastFusedLayer) {
+            outputPrecision = lastFusedLayer->outData[0]->getPrecision();
+        }
+    }
+
+    withCompressedWeights = (weightsCompression == Precision::I8 || weightsCompression == Precision::BF16) &&
+                            outputPrecision == Precision::FP32;
+    if (!withCompressedWeights) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+
+    impl_desc_type impl_type = impl_desc_type::ref_any;
+    if (mayiuse(cpu::avx512_common)) {
+        impl_type = impl_desc_type::jit_avx512;
+    } else if (mayiuse(cpu::avx2)) {
+        impl_type = impl_desc_type::jit_avx2;
+    }
+
+    auto inDims = getParentEdgeAt(0)->getDims();
+    auto outDims = getChildEdgeAt(0)->getDims();
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = true;
+    config.inConfs.resize(1);
+    config.outConfs.resize(1);
+    config.inConfs[0].constant = false;
+    config.inConfs[0].inPlace = -1;
+    config.inConfs[0].desc = MKLDNNMemoryDesc(inDims, memory::f32, MKLDNNMemory::GetPlainFormat(inDims));
+    config.outConfs[0].constant = false;
+    config.outConfs[0].inPlace = -1;
+    config.outConfs[0].desc = MKLDNNMemoryDesc(outDims, memory::f32, MKLDNNMemory::GetPlainFormat(outDims));
+    supportedPrimitiveDescriptors.push_back({config, impl_type, MKLDNNMemory::GetPlainFormat(outDims)});
+}
+
+std::string MKLDNNFullyConnectedNode::getPrimitiveDescriptorType() {
+    // the implementation type alone does not tell the compressed weights path from the mkldnn primitive
+    if (withCompressedWeights)
+        return MKLDNNNode::getPrimitiveDescriptorType() + "_compressed_" + weightsCompression.name();
+    return MKLDNNNode::getPrimitiveDescriptorType();
+}
+
+void MKLDNNFullyConnectedNode::initDescriptor(const InferenceEngine::LayerConfig& config) {
+    if (!withCompressedWeights) {
+        MKLDNNNode::initDescriptor(config);
+        return;
+    }
+
+    // the compressed weights path has the only planar configuration, there is no mkldnn descriptor behind it
+    auto* selectedPD = getSelectedPrimitiveDescriptor();
+    if (selectedPD)
+        selectedPD->getConfig() = config;
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
+    if (withCompressedWeights) {
+        if (!compressedWeights)
+            prepareCompressedWeights();
+        return;
+    }
+
     if (prim)
         return;
 
@@ -273,6 +478,249 @@ void MKLDNNFullyConnectedNode::setPostOps(mkldnn::primitive_attr &attr, bool ini
     attr.set_post_ops(ops);
 }
 
+void MKLDNNFullyConnectedNode::prepareCompressedWeights() {
+    if (mayiuse(cpu::avx512_common)) {
+        compressedOcBlock = 4 * cpu_isa_traits<cpu::avx512_common>::vlen / sizeof(float);
+        compressedRowsBlock = 4;
+    } else if (mayiuse(cpu::avx2)) {
+        compressedOcBlock = 4 * cpu_isa_traits<cpu::avx2>::vlen / sizeof(float);
+        compressedRowsBlock = 2;
+    } else {
+        compressedOcBlock = 32;
+        compressedRowsBlock = 1;
+    }
+
+    auto jcp = jit_fc_compressed_config_params();
+    jcp.wei_dt = MKLDNNExtensionUtils::IEPrecisionToDataType(weightsCompression);
+    jcp.wei_data_size = static_cast<int>(weightsCompression.size());
+    jcp.oc_unroll = 4;
+    for (size_t rows = 1; rows <= compressedRowsBlock; rows++) {
+        jcp.rows = static_cast<int>(rows);
+        if (mayiuse(cpu::avx512_common)) {
+            compressedKernels.emplace_back(new jit_uni_fc_compressed_kernel_f32<cpu::avx512_common>(jcp));
+        } else if (mayiuse(cpu::avx2)) {
+            compressedKernels.emplace_back(new jit_uni_fc_compressed_kernel_f32<cpu::avx2>(jcp));
+        }
+    }
+
+    const Blob::Ptr &weightsBlob = internalBlobs[0];
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsBlob->size() / OC;
+    const size_t ocBlocks = div_up(OC, compressedOcBlock);
+    const size_t weightsSize = ocBlocks * IC * compressedOcBlock * weightsCompression.size();
+    compressedScalesOffset = rnd_up(weightsSize, 64);
+    compressedBiasesOffset = compressedScalesOffset + ocBlocks * compressedOcBlock * sizeof(float);
+    const size_t totalSize = compressedBiasesOffset + ocBlocks * compressedOcBlock * sizeof(float);
+
+    auto create = [&] () {
+        MKLDNNMemoryPtr ptr(new MKLDNNMemory(getEngine()));
+        ptr->Create(MKLDNNDims({static_cast<ptrdiff_t>(totalSize)}), memory::u8, memory::x);
+        ptr->FillZero();
+
+        auto *data = reinterpret_cast<uint8_t *>(ptr->GetData());
+        auto *scales = reinterpret_cast<float *>(data + compressedScalesOffset);
+        auto *biases = reinterpret_cast<float *>(data + compressedBiasesOffset);
+        const auto *src = weightsBlob->cbuffer().as<const float *>();
+        const auto *srcBiases = withBiases ? internalBlobs[1]->cbuffer().as<const float *>() : nullptr;
+
+        parallel_for(ocBlocks, [&](size_t ob) {
+            const size_t ocWork = (std::min)(compressedOcBlock, OC - ob * compressedOcBlock);
+            for (size_t j = 0; j < ocWork; j++) {
+                const size_t oc = ob * compressedOcBlock + j;
+                const float *w = src + oc * IC;
+                if (weightsCompression == Precision::I8) {
+                    // symmetric per output channel quantization keeps zero exact
+                    float absMax = 0.f;
+                    for (size_t i = 0; i < IC; i++)
+                        absMax = (std::max)(absMax, std::fabs(w[i]));
+                    const float scale = absMax / 127.f;
+                    const float invScale = scale != 0.f ? 1.f / scale : 0.f;
+
+                    auto *dst = reinterpret_cast<int8_t *>(data) + ob * IC * compressedOcBlock + j;
+                    for (size_t i = 0; i < IC; i++)
+                        dst[i * compressedOcBlock] = static_cast<int8_t>(std::nearbyint(w[i] * invScale));
+                    scales[oc] = scale;
+                } else {
+                    auto *dst = reinterpret_cast<ie_bf16 *>(data) + ob * IC * compressedOcBlock + j;
+                    for (size_t i = 0; i < IC; i++)
+                        dst[i * compressedOcBlock] = f32tobf16(w[i]);
+                    scales[oc] = 1.f;
+                }
+                biases[oc] = srcBiases ? srcBiases[oc] : 0.f;
+            }
+        });
+
+        return ptr;
+    };
+
+    if (weightCache != nullptr) {
+        // the packed buffer depends on the block size, the biases are a part of it as well
+        MKLDNNMemoryDesc packedDesc(MKLDNNDims({static_cast<ptrdiff_t>(totalSize)}), memory::u8, memory::x);
+        std::string string_hash = MKLDNNWeightsSharing::GetKey(weightsBlob->cbuffer().as<const void *>(),
+                                                               weightsBlob->byteSize(), packedDesc)
+                                  + "_" + weightsCompression.name() + "_" + std::to_string(compressedOcBlock);
+        if (withBiases) {
+            string_hash += "_" + std::to_string(weightCache->GetHashFunc().hash(
+                    internalBlobs[1]->cbuffer().as<const unsigned char *>(), internalBlobs[1]->byteSize()));
+        }
+
+        compressedWeights = weightCache->findOrCreate(string_hash, packedDesc, getEngine(), create);
+    } else {
+        compressedWeights = create();
+    }
+
+    compressedAttr = initPrimitiveAttr();
+    const auto &p = (*compressedAttr.get()).post_ops_;
+    for (int i = 0; i < p.len_; i++) {
+        auto &post_op = p.entry_[i];
+        if (post_op.is_eltwise()) {
+            eltwise_injectors_ref.push_back(std::make_shared<ref_eltwise_scalar_fwd_t>(
+                post_op.eltwise.alg, post_op.eltwise.alpha, post_op.eltwise.beta));
+        } else if (post_op.is_depthwise()) {
+            depthwise_injectors_ref.push_back(std::make_shared<ref_depthwise_scalar_fwd_t>(
+                    post_op.depthwise.alg));
+        }
+    }
+}
+
+void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (withCompressedWeights) {
+        executeCompressed();
+    } else {
+        MKLDNNNode::execute(strm);
+    }
+}
+
+void MKLDNNFullyConnectedNode::executeCompressed() {
+    auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+    auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    const auto *src = reinterpret_cast<const float *>(srcMemPtr->GetData()) +
+            srcMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
+    auto *dst = reinterpret_cast<float *>(dstMemPtr->GetData()) +
+            dstMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    const auto *data = reinterpret_cast<const uint8_t *>(compressedWeights->GetData());
+    const auto *scales = reinterpret_cast<const float *>(data + compressedScalesOffset);
+    const auto *biases = reinterpret_cast<const float *>(data + compressedBiasesOffset);
+
+    const auto &srcDims = getParentEdgeAt(0)->getDims();
+    const size_t OC = weightsDims[0];
+    const size_t IC = std::accumulate(weightsDims.begin() + 1, weightsDims.end(), size_t(1), std::multiplies<size_t>());
+    const size_t rows = static_cast<size_t>(batchToProcess()) * (srcDims.ndims() == 3 ? static_cast<size_t>(srcDims[1]) : 1lu);
+    const size_t ocBlocks = div_up(OC, compressedOcBlock);
+    const size_t rowBlocks = div_up(rows, compressedRowsBlock);
+    const size_t wei_block_size = IC * compressedOcBlock * weightsCompression.size();
+    const bool withPostOps = (*compressedAttr.get()).post_ops_.len_ != 0;
+
+    // the tail of output channels is computed to a buffer to not overrun the destination rows,
+    // every row block uses its own part of it
+    if (OC % compressedOcBlock != 0 && compressedTail.size() < rowBlocks * compressedRowsBlock * compressedOcBlock)
+        compressedTail.resize(rowBlocks * compressedRowsBlock * compressedOcBlock);
+
+    // consecutive row blocks of the same output channels block go to the same thread, so its weights stay in cache
+    parallel_for2d(ocBlocks, rowBlocks, [&](size_t ob, size_t rb) {
+        const size_t oc = ob * compressedOcBlock;
+        const size_t ocWork = (std::min)(compressedOcBlock, OC - oc);
+        const size_t row = rb * compressedRowsBlock;
+        const size_t rowsWork = (std::min)(compressedRowsBlock, rows - row);
+
+        float *out = dst + row * OC + oc;
+        size_t outStride = OC;
+        if (ocWork != compressedOcBlock) {
+            out = compressedTail.data() + row * compressedOcBlock;
+            outStride = compressedOcBlock;
+        }
+
+        if (!compressedKernels.empty()) {
+            auto arg = jit_fc_compressed_call_args();
+            arg.src = src + row * IC;
+            arg.weights = data + ob * wei_block_size;
+            arg.scales = scales + oc;
+            arg.biases = biases + oc;
+            arg.dst = out;
+            arg.src_stride = IC * sizeof(float);
+            arg.dst_stride = outStride * sizeof(float);
+            arg.ic = IC;
+            (*compressedKernels[rowsWork - 1])(&arg);
+        } else {
+            executeCompressedRef(src + row * IC, data + ob * wei_block_size, scales + oc, biases + oc,
+                                 out, rowsWork, IC, IC, outStride);
+        }
+
+        for (size_t r = 0; r < rowsWork; r++) {
+            float *outRow = out + r * outStride;
+            float *dstRow = dst + (row + r) * OC + oc;
+            if (withPostOps) {
+                for (size_t j = 0; j < ocWork; j++)
+                    applyPostOpsScalar(outRow[j], static_cast<int>(oc + j));
+            }
+            if (outRow != dstRow)
+                std::copy_n(outRow, ocWork, dstRow);
+        }
+    });
+}
+
+void MKLDNNFullyConnectedNode::executeCompressedRef(const float *src, const uint8_t *weights, const float *scales,
+                                                    const float *biases, float *dst, size_t rows, size_t ic,
+                                                    size_t srcStride, size_t dstStride) {
+    for (size_t r = 0; r < rows; r++) {
+        // the destination row holds a whole block of output channels, so it accumulates the sums
+        float *acc = dst + r * dstStride;
+        std::fill_n(acc, compressedOcBlock, 0.f);
+        for (size_t i = 0; i < ic; i++) {
+            const float value = src[r * srcStride + i];
+            if (weightsCompression == Precision::I8) {
+                const auto *w = reinterpret_cast<const int8_t *>(weights) + i * compressedOcBlock;
+                for (size_t j = 0; j < compressedOcBlock; j++)
+                    acc[j] += value * static_cast<float>(w[j]);
+            } else {
+                const auto *w = reinterpret_cast<const ie_bf16 *>(weights) + i * compressedOcBlock;
+                for (size_t j = 0; j < compressedOcBlock; j++)
+                    acc[j] += value * bf16tof32(w[j]);
+            }
+        }
+        for (size_t j = 0; j < compressedOcBlock; j++)
+            acc[j] = acc[j] * scales[j] + biases[j];
+    }
+}
+
+inline void MKLDNNFullyConnectedNode::applyPostOpsScalar(float &dst_value, int index_c) {
+    const auto &p = (*compressedAttr.get()).post_ops_;
+    int eltwise_inj_idx = 0;
+    int depthwise_inj_idx = 0;
+    for (int i = 0; i < p.len_; i++) {
+        auto &post_op = p.entry_[i];
+        if (post_op.is_eltwise()) {
+            dst_value = eltwise_injectors_ref[eltwise_inj_idx]->compute_scalar(dst_value);
+            eltwise_inj_idx++;
+        } else if (post_op.is_depthwise()) {
+            auto depthwise_weights = post_op.depthwise.weights_data + index_c;
+            auto depthwise_bias = post_op.depthwise.biases_data + index_c;
+            dst_value = depthwise_injectors_ref[depthwise_inj_idx]->compute_scalar(dst_value, depthwise_weights, depthwise_bias);
+            depthwise_inj_idx++;
+        } else if (post_op.is_quantization()) {
+            // the output is FP32, so the quantized values are always rounded
+            bool do_dequantization = post_op.quantization.alg == alg_kind::quantization_quantize_dequantize;
+
+            auto quant = post_op.quantization;
+
+            float crop_low = quant.crop_low_data->shifts_[quant.crop_low_data->count_ == 1 ? 0 : index_c];
+            float crop_high = quant.crop_high_data->shifts_[quant.crop_high_data->count_ == 1 ? 0 : index_c];
+            float input_scale = quant.input_scale_data->scales_[quant.input_scale_data->count_ == 1 ? 0 : index_c];
+            float input_shift = quant.input_shift_data->shifts_[quant.input_shift_data->count_ == 1 ? 0 : index_c];
+
+            dst_value = nstl::min(crop_high, nstl::max(crop_low, dst_value));
+            dst_value = roundf(dst_value * input_scale + input_shift);
+
+            if (do_dequantization) {
+                float output_scale = quant.output_scale_data->scales_[quant.output_scale_data->count_ == 1 ? 0 : index_c];
+                float output_shift = quant.output_shift_data->shifts_[quant.output_shift_data->count_ == 1 ? 0 : index_c];
+                dst_value = dst_value * output_scale + output_shift;
+            }
+        }
+    }
+}
+
 bool MKLDNNFullyConnectedNode::created() const {
     return getType() == FullyConnected;
 }
@@ -9,17 +9,56 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include "ref_eltwise.hpp"
+#include "ref_depthwise.hpp"
 
 namespace MKLDNNPlugin {
 
+struct jit_fc_compressed_config_params {
+    mkldnn::memory::data_type wei_dt;
+    int wei_data_size;
+    int rows;
+    int oc_unroll;
+};
+
+struct jit_fc_compressed_call_args {
+    const float *src;
+    const void *weights;
+    const float *scales;
+    const float *biases;
+    float *dst;
+    size_t src_stride;
+    size_t dst_stride;
+    size_t ic;
+};
+
+struct jit_uni_fc_compressed_kernel {
+    void (*ker_)(const jit_fc_compressed_call_args *);
+
+    void operator()(const jit_fc_compressed_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_fc_compressed_kernel(jit_fc_compressed_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_fc_compressed_kernel() {}
+
+    jit_fc_compressed_config_params jcp_;
+};
+
 class MKLDNNFullyConnectedNode : public MKLDNNNode {
 public:
     MKLDNNFullyConnectedNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
     ~MKLDNNFullyConnectedNode() override = default;
 
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void initDescriptor(const InferenceEngine::LayerConfig& config) override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool isExecutedByPrimitive() const override { return !withCompressedWeights; }
     bool created() const override;
+    std::string getPrimitiveDescriptorType() override;
     bool canBeInPlace() const override {
         return false;
     }
@@ -52,6 +91,28 @@ private:
 
     bool withBiases;
     int baseInputsNumber;
+
+    // Weights stored in I8 (with a per output channel scale) or BF16 and decompressed on the fly,
+    // the precision is requested via the KEY_CPU_WEIGHTS_COMPRESSION plugin config
+    InferenceEngine::Precision weightsCompression = InferenceEngine::Precision::UNSPECIFIED;
+    bool withCompressedWeights = false;
+    size_t compressedOcBlock = 0;
+    size_t compressedRowsBlock = 0;
+    size_t compressedScalesOffset = 0;
+    size_t compressedBiasesOffset = 0;
+    MKLDNNMemoryPtr compressedWeights;
+    std::shared_ptr<mkldnn::primitive_attr> compressedAttr;
+    std::vector<std::shared_ptr<jit_uni_fc_compressed_kernel>> compressedKernels;
+    std::vector<float> compressedTail;
+
+    void prepareCompressedWeights();
+    void executeCompressed();
+    void executeCompressedRef(const float *src, const uint8_t *weights, const float *scales, const float *biases,
+                              float *dst, size_t rows, size_t ic, size_t srcStride, size_t dstStride);
+    inline void applyPostOpsScalar(float &dst_value, int index_c);
+
+    std::vector<std::shared_ptr<mkldnn::impl::cpu::ref_eltwise_scalar_fwd_t>> eltwise_injectors_ref;
+    std::vector<std::shared_ptr<mkldnn::impl::cpu::ref_depthwise_scalar_fwd_t>> depthwise_injectors_ref;
 };
 
 }  // namespace MKLDNNPlugin
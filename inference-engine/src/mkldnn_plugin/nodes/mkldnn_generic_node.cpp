@@ -5,9 +5,16 @@
 #include <mkldnn_extension_mngr.h>
 #include <mkldnn_extension_utils.h>
 #include "mkldnn_generic_node.h"
+#include "mkldnn_activation_node.h"
+#include "mkldnn_depthwise_node.h"
+#include "mkldnn_quantize_node.h"
+#include "nodes/base.hpp"
 #include <vector>
 #include <string>
+#include <cmath>
+#include <algorithm>
 #include <blob_factory.hpp>
+#include "ref_eltwise.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -29,24 +36,9 @@ void MKLDNNGenericNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    InferenceEngine::ResponseDesc resp;
-    if (impls.empty()) {
-        if (!extFactory)
-            THROW_IE_EXCEPTION << "Descriptor for generic primitive doesn't exist";
-
-        std::vector<InferenceEngine::ILayerImpl::Ptr> impls_no_exec;
-
-        InferenceEngine::StatusCode rc = extFactory->getImplementations(impls_no_exec, &resp);
-        for (const auto& impl : impls_no_exec) {
-            if (auto exec_impl = std::dynamic_pointer_cast<InferenceEngine::ILayerExecImpl>(impl)) {
-                impls.emplace_back(exec_impl);
-            }
-        }
-        if (rc != InferenceEngine::OK) {
-            THROW_IE_EXCEPTION << resp.msg;
-        }
-    }
+    createImplementations();
 
+    InferenceEngine::ResponseDesc resp;
     for (auto &impl : impls) {
         std::vector<InferenceEngine::LayerConfig> configs;
         auto rc = impl->getSupportedConfigurations(configs, &resp);
@@ -68,7 +60,118 @@ void MKLDNNGenericNode::initSupportedPrimitiveDescriptors() {
     }
 }
 
+void MKLDNNGenericNode::createImplementations() {
+    if (!impls.empty())
+        return;
+
+    if (!extFactory)
+        THROW_IE_EXCEPTION << "Descriptor for generic primitive doesn't exist";
+
+    InferenceEngine::ResponseDesc resp;
+    std::vector<InferenceEngine::ILayerImpl::Ptr> impls_no_exec;
+
+    InferenceEngine::StatusCode rc = extFactory->getImplementations(impls_no_exec, &resp);
+    for (const auto& impl : impls_no_exec) {
+        if (auto exec_impl = std::dynamic_pointer_cast<InferenceEngine::ILayerExecImpl>(impl)) {
+            impls.emplace_back(exec_impl);
+        }
+    }
+    if (rc != InferenceEngine::OK) {
+        THROW_IE_EXCEPTION << resp.msg;
+    }
+}
+
+bool MKLDNNGenericNode::canFusePostOps() {
+    if (!extFactory && impls.empty())
+        return false;
+    createImplementations();
+
+    for (auto &impl : impls) {
+        auto extImpl = std::dynamic_pointer_cast<InferenceEngine::Extensions::Cpu::ExtLayerBase>(impl);
+        if (!extImpl || !extImpl->canFusePostOps())
+            return false;
+    }
+    return !impls.empty() && getCnnLayer() && getCnnLayer()->outData.size() == 1 &&
+           getCnnLayer()->outData[0]->getPrecision() == InferenceEngine::Precision::FP32;
+}
+
+void MKLDNNGenericNode::setPostOps() {
+    using PostOps = InferenceEngine::Extensions::Cpu::PostOps;
+    PostOps postOps(getChildEdgeAt(0)->getDesc());
+
+    for (auto &node : fusedWith) {
+        auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode *>(node.get());
+        if (quantizeNode) {
+            const bool dequantize = quantizeNode->getAlgorithm() == algorithm::quantization_quantize_dequantize;
+            const auto cropLow = postOps.perChannel(quantizeNode->getCropLow());
+            const auto cropHigh = postOps.perChannel(quantizeNode->getCropHigh());
+            const auto inputScale = postOps.perChannel(quantizeNode->getInputScale());
+            const auto inputShift = postOps.perChannel(quantizeNode->getInputShift());
+            const auto outputScale = postOps.perChannel(quantizeNode->getOutputScale());
+            const auto outputShift = postOps.perChannel(quantizeNode->getOutputShift());
+            postOps.append([=](float* data, size_t count, const PostOps::Channels& channels) {
+                PostOps::forEach(data, count, channels, [&](float value, size_t c) {
+                    value = (std::min)(cropHigh[c], (std::max)(cropLow[c], value));
+                    value = std::round(value * inputScale[c] + inputShift[c]);
+                    return dequantize ? value * outputScale[c] + outputShift[c] : value;
+                });
+            });
+            continue;
+        }
+
+        auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
+        if (depthwiseNode) {
+            auto* depthwiseLayer = dynamic_cast<InferenceEngine::WeightableLayer*>(depthwiseNode->getCnnLayer().get());
+            if (depthwiseLayer == nullptr || !depthwiseLayer->_weights)
+                THROW_IE_EXCEPTION << "Cannot get weights of " << depthwiseNode->getName();
+
+            const float* weightsData = depthwiseLayer->_weights->cbuffer().as<const float*>();
+            const auto weights = postOps.perChannel(std::vector<float>(weightsData, weightsData + depthwiseLayer->_weights->size()));
+            std::vector<float> biases(weights.size(), 0.f);
+            if (depthwiseNode->isWithBiases() && depthwiseLayer->_biases) {
+                const float* biasesData = depthwiseLayer->_biases->cbuffer().as<const float*>();
+                biases = postOps.perChannel(std::vector<float>(biasesData, biasesData + depthwiseLayer->_biases->size()));
+            }
+
+            if (depthwiseNode->getAlgorithm() == algorithm::depthwise_scale_shift) {
+                postOps.append([weights, biases](float* data, size_t count, const PostOps::Channels& channels) {
+                    PostOps::forEach(data, count, channels, [&](float value, size_t c) {
+                        return value * weights[c] + biases[c];
+                    });
+                });
+            } else {
+                postOps.append([weights](float* data, size_t count, const PostOps::Channels& channels) {
+                    PostOps::forEach(data, count, channels, [&](float value, size_t c) {
+                        return value > 0.f ? value : value * weights[c];
+                    });
+                });
+            }
+            continue;
+        }
+
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (activationNode) {
+            auto injector = std::make_shared<mkldnn::impl::cpu::ref_eltwise_scalar_fwd_t>(
+                    mkldnn::convert_to_c(activationNode->getAlgorithm()), activationNode->getAlpha(), activationNode->getBeta());
+            postOps.append([injector](float* data, size_t count, const PostOps::Channels&) {
+                for (size_t i = 0; i < count; i++)
+                    data[i] = injector->compute_scalar(data[i]);
+            });
+            continue;
+        }
+
+        THROW_IE_EXCEPTION << "Fusing of " << NameFromType(node->getType()) << " operation to " << getName() << " node is not implemented";
+    }
+
+    for (auto &impl : impls) {
+        if (auto extImpl = std::dynamic_pointer_cast<InferenceEngine::Extensions::Cpu::ExtLayerBase>(impl))
+            extImpl->setPostOps(postOps);
+    }
+}
+
 void MKLDNNGenericNode::createPrimitive() {
+    if (!fusedWith.empty())
+        setPostOps();
     if (extFactory || !impls.empty()) {
         return;
     }
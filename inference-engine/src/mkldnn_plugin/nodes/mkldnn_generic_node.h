@@ -35,8 +35,16 @@ public:
     void execLayer();
     void cleanup() override;
 
+    /**
+     * @brief Checks whether all implementations apply fused element-wise operations to the output themselves
+     */
+    bool canFusePostOps();
+
 
 protected:
+    void createImplementations();
+    void setPostOps();
+
     InferenceEngine::ILayerImplFactory::Ptr extFactory;
     std::vector<InferenceEngine::ILayerExecImpl::Ptr> impls;
     std::map<std::string, std::string> params;
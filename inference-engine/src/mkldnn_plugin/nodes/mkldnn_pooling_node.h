@@ -23,6 +23,7 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     void initDescriptor(const InferenceEngine::LayerConfig &config) override;
     void createPrimitive() override;
+    bool isExecutedByPrimitive() const override { return true; }
     bool created() const override;
     bool canBeInPlace() const override {
         return false;
@@ -56,6 +56,8 @@ public:
     InferenceEngine::Precision getInputPrecision() const { return inputPrecision; }
     InferenceEngine::Precision getOutputPrecision() const { return outputPrecision; }
 
+    void setInputPrecision(InferenceEngine::Precision newInputPrecision) { inputPrecision = newInputPrecision; }
+
     void appendPostOps(mkldnn::post_ops& ops) override;
 
 private:
@@ -22,6 +22,7 @@ public:
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
     void getSupportedDescriptors() override;
     void createPrimitive() override;
+    bool isExecutedByPrimitive() const override { return true; }
     bool created() const override;
 
 private:
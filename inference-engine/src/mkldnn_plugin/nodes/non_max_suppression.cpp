@@ -3,6 +3,7 @@
 //
 
 #include "base.hpp"
+#include "non_max_suppression_imp.hpp"
 
 #include <cmath>
 #include <string>
@@ -93,41 +94,6 @@ public:
         }
     }
 
-    static float intersectionOverUnion(float* boxesI, float* boxesJ, bool center_point_box) {
-        float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
-        if (center_point_box) {
-            //  box format: x_center, y_center, width, height
-            yminI = boxesI[1] - boxesI[3] / 2.f;
-            xminI = boxesI[0] - boxesI[2] / 2.f;
-            ymaxI = boxesI[1] + boxesI[3] / 2.f;
-            xmaxI = boxesI[0] + boxesI[2] / 2.f;
-            yminJ = boxesJ[1] - boxesJ[3] / 2.f;
-            xminJ = boxesJ[0] - boxesJ[2] / 2.f;
-            ymaxJ = boxesJ[1] + boxesJ[3] / 2.f;
-            xmaxJ = boxesJ[0] + boxesJ[2] / 2.f;
-        } else {
-            //  box format: y1, x1, y2, x2
-            yminI = (std::min)(boxesI[0], boxesI[2]);
-            xminI = (std::min)(boxesI[1], boxesI[3]);
-            ymaxI = (std::max)(boxesI[0], boxesI[2]);
-            xmaxI = (std::max)(boxesI[1], boxesI[3]);
-            yminJ = (std::min)(boxesJ[0], boxesJ[2]);
-            xminJ = (std::min)(boxesJ[1], boxesJ[3]);
-            ymaxJ = (std::max)(boxesJ[0], boxesJ[2]);
-            xmaxJ = (std::max)(boxesJ[1], boxesJ[3]);
-        }
-
-        float areaI = (ymaxI - yminI) * (xmaxI - xminI);
-        float areaJ = (ymaxJ - yminJ) * (xmaxJ - xminJ);
-        if (areaI <= 0.f || areaJ <= 0.f)
-            return 0.f;
-
-        float intersection_area =
-            (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ), 0.f) *
-            (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ), 0.f);
-        return intersection_area / (areaI + areaJ - intersection_area);
-    }
-
     typedef struct {
         float score;
         int batch_index;
@@ -169,42 +135,57 @@ public:
         // scores shape: {num_batches, num_classes, num_boxes}
         int num_batches = static_cast<int>(scores_dims[0]);
         int num_classes = static_cast<int>(scores_dims[1]);
-        std::vector<filteredBoxes> fb;
 
+        // Boxes are converted once into SoA corner form shared by all classes of the batch
+        const size_t soa_size = static_cast<size_t>(num_batches) * num_boxes;
+        std::vector<float> boxes_soa(5 * soa_size);
+        float* y1 = boxes_soa.data();
+        float* x1 = y1 + soa_size;
+        float* y2 = x1 + soa_size;
+        float* x2 = y2 + soa_size;
+        float* areas = x2 + soa_size;
+        parallel_for2d(num_batches, num_boxes, [&](int batch, int box_idx) {
+            const float *box = boxes + batch * boxesStrides[0] + box_idx * 4;
+            const size_t i = static_cast<size_t>(batch) * num_boxes + box_idx;
+            if (center_point_box) {
+                //  box format: x_center, y_center, width, height
+                y1[i] = box[1] - box[3] / 2.f;
+                x1[i] = box[0] - box[2] / 2.f;
+                y2[i] = box[1] + box[3] / 2.f;
+                x2[i] = box[0] + box[2] / 2.f;
+            } else {
+                //  box format: y1, x1, y2, x2
+                y1[i] = (std::min)(box[0], box[2]);
+                x1[i] = (std::min)(box[1], box[3]);
+                y2[i] = (std::max)(box[0], box[2]);
+                x2[i] = (std::max)(box[1], box[3]);
+            }
+            areas[i] = (y2[i] - y1[i]) * (x2[i] - x1[i]);
+        });
+
+        nms_conf conf;
+        conf.num_boxes = num_boxes;
+        conf.max_output_boxes_per_class = max_output_boxes_per_class;
+        conf.iou_threshold = iou_threshold;
+        conf.score_threshold = score_threshold;
+
+        std::vector<std::vector<nms_candidate>> selected(static_cast<size_t>(num_batches) * num_classes);
+        parallel_for2d(num_batches, num_classes, [&](int batch, int class_idx) {
+            const size_t offset = static_cast<size_t>(batch) * num_boxes;
+            const nms_boxes batch_boxes = { y1 + offset, x1 + offset, y2 + offset, x2 + offset, areas + offset };
+            const float *scoresPtr = scores + batch * scoresStrides[0] + class_idx * scoresStrides[1];
+            XARCH::nms_select(batch_boxes, scoresPtr, conf, selected[batch * num_classes + class_idx]);
+        });
+
+        std::vector<filteredBoxes> fb;
+        size_t fb_size = 0;
+        for (const auto& sel : selected)
+            fb_size += sel.size();
+        fb.reserve(fb_size);
         for (int batch = 0; batch < num_batches; batch++) {
-            float *boxesPtr = boxes + batch * boxesStrides[0];
             for (int class_idx = 0; class_idx < num_classes; class_idx++) {
-                float *scoresPtr = scores + batch * scoresStrides[0] + class_idx * scoresStrides[1];
-                std::vector<std::pair<float, int> > scores_vector;
-                for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-                    if (scoresPtr[box_idx] > score_threshold)
-                        scores_vector.push_back(std::make_pair(scoresPtr[box_idx], box_idx));
-                }
-
-                if (scores_vector.size()) {
-                    parallel_sort(scores_vector.begin(), scores_vector.end(),
-                        [](const std::pair<float, int>& l, const std::pair<float, int>& r) { return l.first > r.first; });
-
-                    int io_selection_size = 1;
-                    fb.push_back({ scores_vector[0].first, batch, class_idx, scores_vector[0].second });
-                    for (int box_idx = 1; (box_idx < static_cast<int>(scores_vector.size()) && io_selection_size < max_output_boxes_per_class); box_idx++) {
-                        bool box_is_selected = true;
-                        for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                            float iou = intersectionOverUnion(&boxesPtr[scores_vector[box_idx].second * 4],
-                                             &boxesPtr[scores_vector[idx].second * 4], center_point_box);
-                            if (iou > iou_threshold) {
-                                box_is_selected = false;
-                                break;
-                            }
-                        }
-
-                        if (box_is_selected) {
-                            scores_vector[io_selection_size] = scores_vector[box_idx];
-                            io_selection_size++;
-                            fb.push_back({ scores_vector[box_idx].first, batch, class_idx, scores_vector[box_idx].second });
-                        }
-                    }
-                }
+                for (const auto& box : selected[batch * num_classes + class_idx])
+                    fb.push_back({ box.score, batch, class_idx, box.box_index });
             }
         }
 
@@ -0,0 +1,144 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "non_max_suppression_imp.hpp"
+
+#include <algorithm>
+#include <vector>
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#include "nodes/common/uni_simd.h"
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+// Selected boxes kept in SoA layout so that a candidate is compared with a whole vector of them at once
+struct nms_selected_boxes {
+    std::vector<float> y1, x1, y2, x2, areas;
+
+    explicit nms_selected_boxes(size_t capacity) {
+        y1.reserve(capacity);
+        x1.reserve(capacity);
+        y2.reserve(capacity);
+        x2.reserve(capacity);
+        areas.reserve(capacity);
+    }
+
+    void push_back(const nms_boxes& boxes, int idx) {
+        y1.push_back(boxes.y1[idx]);
+        x1.push_back(boxes.x1[idx]);
+        y2.push_back(boxes.y2[idx]);
+        x2.push_back(boxes.x2[idx]);
+        areas.push_back(boxes.areas[idx]);
+    }
+
+    size_t size() const { return areas.size(); }
+};
+
+inline float intersection_over_union(float y1, float x1, float y2, float x2, float area,
+                                     const nms_selected_boxes& sel, size_t j) {
+    const float intersection_area =
+        (std::max)((std::min)(y2, sel.y2[j]) - (std::max)(y1, sel.y1[j]), 0.f) *
+        (std::max)((std::min)(x2, sel.x2[j]) - (std::max)(x1, sel.x1[j]), 0.f);
+    return intersection_area / (area + sel.areas[j] - intersection_area);
+}
+
+// Returns true if IoU of box 'idx' with any of the selected boxes exceeds the threshold
+inline bool is_suppressed(const nms_boxes& boxes, int idx, const nms_selected_boxes& sel, float iou_threshold) {
+    const float y1 = boxes.y1[idx];
+    const float x1 = boxes.x1[idx];
+    const float y2 = boxes.y2[idx];
+    const float x2 = boxes.x2[idx];
+    const float area = boxes.areas[idx];
+    const size_t num = sel.size();
+    size_t j = 0;
+
+#if defined(HAVE_AVX512F)
+    const size_t block_size = 16;
+#elif defined(HAVE_AVX2)
+    const size_t block_size = 8;
+#endif
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const auto vy1 = _mm_uni_set1_ps(y1);
+    const auto vx1 = _mm_uni_set1_ps(x1);
+    const auto vy2 = _mm_uni_set1_ps(y2);
+    const auto vx2 = _mm_uni_set1_ps(x2);
+    const auto varea = _mm_uni_set1_ps(area);
+    const auto vthreshold = _mm_uni_set1_ps(iou_threshold);
+    const auto vzero = _mm_uni_setzero_ps();
+    for (; j + block_size <= num; j += block_size) {
+        auto vh = _mm_uni_sub_ps(_mm_uni_min_ps(vy2, _mm_uni_loadu_ps(&sel.y2[j])), _mm_uni_max_ps(vy1, _mm_uni_loadu_ps(&sel.y1[j])));
+        auto vw = _mm_uni_sub_ps(_mm_uni_min_ps(vx2, _mm_uni_loadu_ps(&sel.x2[j])), _mm_uni_max_ps(vx1, _mm_uni_loadu_ps(&sel.x1[j])));
+        auto vintersection = _mm_uni_mul_ps(_mm_uni_max_ps(vh, vzero), _mm_uni_max_ps(vw, vzero));
+        auto vunion = _mm_uni_sub_ps(_mm_uni_add_ps(varea, _mm_uni_loadu_ps(&sel.areas[j])), vintersection);
+        auto vmask = _mm_uni_cmpgt_ps(_mm_uni_div_ps(vintersection, vunion), vthreshold);
+#if defined(HAVE_AVX512F)
+        if (vmask)
+            return true;
+#else
+        if (_mm_uni_movemask_ps(vmask))
+            return true;
+#endif
+    }
+#endif
+
+    for (; j < num; j++) {
+        if (intersection_over_union(y1, x1, y2, x2, area, sel, j) > iou_threshold)
+            return true;
+    }
+    return false;
+}
+
+}  // namespace
+
+void nms_select(const nms_boxes& boxes, const float* scores, const nms_conf& conf, std::vector<nms_candidate>& selected) {
+    selected.clear();
+
+    std::vector<nms_candidate> candidates;
+    candidates.reserve(conf.num_boxes);
+    for (int box_idx = 0; box_idx < conf.num_boxes; box_idx++) {
+        if (scores[box_idx] > conf.score_threshold)
+            candidates.push_back({ scores[box_idx], box_idx });
+    }
+    if (candidates.empty() || conf.max_output_boxes_per_class <= 0)
+        return;
+
+    // Selection usually stops long before all candidates are visited,
+    // so candidates are popped from a heap instead of sorting all of them
+    auto less = [](const nms_candidate& l, const nms_candidate& r) {
+        return l.score < r.score || (l.score == r.score && l.box_index > r.box_index);
+    };
+    std::make_heap(candidates.begin(), candidates.end(), less);
+
+    const size_t max_selected = static_cast<size_t>(conf.max_output_boxes_per_class);
+    nms_selected_boxes sel((std::min)(max_selected, candidates.size()));
+    selected.reserve(sel.areas.capacity());
+
+    while (!candidates.empty() && selected.size() < max_selected) {
+        std::pop_heap(candidates.begin(), candidates.end(), less);
+        const nms_candidate candidate = candidates.back();
+        candidates.pop_back();
+
+        // Degenerated box has zero IoU with any other box: it is never suppressed and never suppresses
+        const bool is_degenerated = boxes.areas[candidate.box_index] <= 0.f;
+        // Hard NMS drops the candidate, soft-NMS would re-push it with a decayed score
+        if (!is_degenerated && is_suppressed(boxes, candidate.box_index, sel, conf.iou_threshold))
+            continue;
+
+        selected.push_back(candidate);
+        if (!is_degenerated)
+            sel.push_back(boxes, candidate.box_index);
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
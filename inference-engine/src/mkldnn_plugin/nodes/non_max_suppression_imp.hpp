@@ -0,0 +1,43 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+// Boxes of one batch in SoA layout, corners are ordered: y1 <= y2, x1 <= x2
+struct nms_boxes {
+    const float* y1;
+    const float* x1;
+    const float* y2;
+    const float* x2;
+    const float* areas;
+};
+
+struct nms_conf {
+    int num_boxes;
+    int max_output_boxes_per_class;
+    float iou_threshold;
+    float score_threshold;
+};
+
+struct nms_candidate {
+    float score;
+    int box_index;
+};
+
+namespace XARCH {
+
+void nms_select(const nms_boxes& boxes, const float* scores, const nms_conf& conf, std::vector<nms_candidate>& selected);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -4,19 +4,143 @@
 
 #include "base.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <cfloat>
 #include <string>
 #include <vector>
 #include <cassert>
+#include <memory>
+#include <type_traits>
 #include <ie_util_internal.hpp>
 #include "ie_parallel.hpp"
+#include "jit_generator.hpp"
+
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::utils;
 
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+#define GET_OFF(field) offsetof(jit_reduce_call_args, field)
+
+enum class jit_reduce_op { sum, sum_square, abs_sum, max, min, prod };
+
+struct jit_reduce_config_params {
+    jit_reduce_op op;
+    // false: accumulates a contiguous row into one vector of partial results
+    // true: accumulates a contiguous row into a row of results element-wise
+    bool vertical;
+};
+
+struct jit_reduce_call_args {
+    const float *src;
+    float *dst;
+    size_t work_amount;
+};
+
+struct jit_uni_reduce_kernel {
+    void (*ker_)(const jit_reduce_call_args *);
+
+    void operator()(const jit_reduce_call_args *args) { assert(ker_); ker_(args); }
+
+    explicit jit_uni_reduce_kernel(jit_reduce_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_reduce_kernel() {}
+
+    jit_reduce_config_params jcp_;
+};
+
+// Processes the whole vectors of the row only, the tail is left to the caller
+template <cpu_isa_t isa>
+struct jit_uni_reduce_kernel_f32 : public jit_uni_reduce_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_reduce_kernel_f32)
+
+    explicit jit_uni_reduce_kernel_f32(jit_reduce_config_params jcp) : jit_uni_reduce_kernel(jcp), jit_generator() {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        if (!jcp_.vertical)
+            uni_vmovups(vmm_dst, ptr[reg_dst]);
+
+        int step = vlen / sizeof(float);
+        L(loop_label); {
+            cmp(reg_work_amount, step);
+            jl(loop_end_label, T_NEAR);
+
+            uni_vmovups(vmm_src, ptr[reg_src]);
+            if (jcp_.vertical)
+                uni_vmovups(vmm_dst, ptr[reg_dst]);
+
+            reduce_vector();
+
+            if (jcp_.vertical) {
+                uni_vmovups(ptr[reg_dst], vmm_dst);
+                add(reg_dst, step * sizeof(float));
+            }
+            add(reg_src, step * sizeof(float));
+            sub(reg_work_amount, step);
+
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        if (!jcp_.vertical)
+            uni_vmovups(ptr[reg_dst], vmm_dst);
+
+        this->postamble();
+
+        ker_ = (decltype(ker_))this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == sse42, Xbyak::Xmm, isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    size_t vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_src = Vmm(0);
+    Vmm vmm_dst = Vmm(1);
+    Vmm vmm_aux = Vmm(2);
+
+    inline void reduce_vector() {
+        switch (jcp_.op) {
+            case jit_reduce_op::sum:
+                uni_vaddps(vmm_dst, vmm_dst, vmm_src);
+                break;
+            case jit_reduce_op::sum_square:
+                uni_vfmadd231ps(vmm_dst, vmm_src, vmm_src);
+                break;
+            case jit_reduce_op::abs_sum:
+                // |x| = max(x, 0 - x)
+                uni_vpxor(vmm_aux, vmm_aux, vmm_aux);
+                uni_vsubps(vmm_aux, vmm_aux, vmm_src);
+                uni_vmaxps(vmm_src, vmm_src, vmm_aux);
+                uni_vaddps(vmm_dst, vmm_dst, vmm_src);
+                break;
+            case jit_reduce_op::max:
+                uni_vmaxps(vmm_dst, vmm_dst, vmm_src);
+                break;
+            case jit_reduce_op::min:
+                uni_vminps(vmm_dst, vmm_dst, vmm_src);
+                break;
+            case jit_reduce_op::prod:
+                uni_vmulps(vmm_dst, vmm_dst, vmm_src);
+                break;
+        }
+    }
+};
+
 class ReduceImpl: public ExtLayerBase {
 public:
     explicit ReduceImpl(const CNNLayer* layer) {
@@ -68,9 +192,50 @@ public:
                 THROW_IE_EXCEPTION << layer->name << " Incorrect Reduce layer type!";
 
             src_dims = layer->insData[REDUCE_DATA].lock()->getTensorDesc().getDims();
-            srcStrides = layer->insData[REDUCE_DATA].lock()->getTensorDesc().getBlockingDesc().getStrides();
 
             addConfig(layer, { { ConfLayout::PLN, false }, { ConfLayout::PLN, false } }, { { ConfLayout::PLN, false } });
+
+            // Reduction over batch and spatial axes keeps channel blocks untouched, so blocked
+            // layouts are processed as is and the graph does not need reorders around the layer
+            SizeVector axes;
+            if (keep_dims && (data_dims.size() == 4 || data_dims.size() == 5) &&
+                    layer->insData[REDUCE_DATA].lock()->getTensorDesc().getPrecision() == Precision::FP32 &&
+                    layer->outData[0]->getTensorDesc().getPrecision() == Precision::FP32 &&
+                    getConstAxes(layer, axes) && std::find(axes.begin(), axes.end(), 1) == axes.end()) {
+                ConfLayout blk_layout = mayiuse(avx512_common) ? ConfLayout::BLK16 : ConfLayout::BLK8;
+                addConfig(layer, { { blk_layout, false }, { ConfLayout::PLN, false } }, { { blk_layout, false } });
+            }
+
+            jit_reduce_op op = jit_reduce_op::sum;
+            bool jit_supported = true;
+            switch (reduceMode) {
+                case Reduce::Sum:
+                case Reduce::Mean:
+                case Reduce::LogSum:
+                    op = jit_reduce_op::sum; break;
+                case Reduce::SumSquare:
+                case Reduce::L2:
+                    op = jit_reduce_op::sum_square; break;
+                case Reduce::L1:
+                    op = jit_reduce_op::abs_sum; break;
+                case Reduce::Max:
+                    op = jit_reduce_op::max; break;
+                case Reduce::Min:
+                    op = jit_reduce_op::min; break;
+                case Reduce::Prod:
+                    op = jit_reduce_op::prod; break;
+                default:
+                    jit_supported = false;
+            }
+            if (jit_supported) {
+                if (mayiuse(avx512_common)) {
+                    createKernels<avx512_common>(op);
+                } else if (mayiuse(avx2)) {
+                    createKernels<avx2>(op);
+                } else if (mayiuse(sse42)) {
+                    createKernels<sse42>(op);
+                }
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -85,7 +250,7 @@ public:
             if (axis < 0)
                 axis += data_dims.size();
 
-            if (static_cast<size_t>(axis) > data_dims.size()) {
+            if (static_cast<size_t>(axis) >= data_dims.size()) {
                 if (resp) {
                     std::string errorMsg = "Index to reduce exceeds data tensor dimension";
                     errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
@@ -98,18 +263,36 @@ public:
         size_t reduced_dims_work_amount = 1;
         InferenceEngine::SizeVector our_dims, out_dims, axes_for_reduction;
         for (size_t i = 0; i < src_dims.size(); i++) {
-            bool found = false;
-            for (size_t axis : axes)
-                if (i == axis) found = true;
-
+            bool found = std::find(axes.begin(), axes.end(), i) != axes.end();
             if (found) {
-                axes_for_reduction.push_back(i);
                 reduced_dims_work_amount *= src_dims[i];
                 if (keep_dims) out_dims.push_back(1);
-                our_dims.push_back(1);
             } else {
                 out_dims.push_back(src_dims[i]);
-                our_dims.push_back(src_dims[i]);
+            }
+        }
+
+        // The reduction runs over the memory dims, which are the tensor dims for the planar layout.
+        // Inner channel blocks are never reduced: blocked layout is selected only when channels are kept
+        const auto& src_blk_desc = inputs[REDUCE_DATA]->getTensorDesc().getBlockingDesc();
+        const SizeVector& src_blk_dims = src_blk_desc.getBlockDims();
+        const SizeVector& src_blk_strides = src_blk_desc.getStrides();
+        const SizeVector& src_order = src_blk_desc.getOrder();
+        const bool blocked = src_blk_dims.size() != src_dims.size();
+        if (blocked && std::find(axes.begin(), axes.end(), 1) != axes.end()) {
+            if (resp) {
+                std::string errorMsg = "Reduction over channels is not supported for blocked layout";
+                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+            }
+            return GENERAL_ERROR;
+        }
+        for (size_t i = 0; i < src_blk_dims.size(); i++) {
+            bool found = std::find(axes.begin(), axes.end(), src_order[i]) != axes.end();
+            if (found) {
+                axes_for_reduction.push_back(i);
+                our_dims.push_back(1);
+            } else {
+                our_dims.push_back(src_blk_dims[i]);
             }
         }
 
@@ -140,19 +323,26 @@ public:
         auto compare = getPrecisionMask(inputs[REDUCE_DATA]->getTensorDesc().getPrecision(), outputs[0]->getTensorDesc().getPrecision());
         switch (compare) {
             case getPrecisionMask(Precision::FP32, Precision::FP32):
-                return reduce_type<float , float>(inputs, outputs, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims);
+                return reduce_type<float , float>(inputs, outputs, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims,
+                                                       src_blk_dims, src_blk_strides);
             case getPrecisionMask(Precision::I32, Precision::I64):
-                return reduce_type<int32_t , int64_t>(inputs, outputs, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims);
+                return reduce_type<int32_t , int64_t>(inputs, outputs, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims,
+                                                       src_blk_dims, src_blk_strides);
             case getPrecisionMask(Precision::I32, Precision::U64):
-                return reduce_type<int32_t , uint64_t>(inputs, outputs, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims);
+                return reduce_type<int32_t , uint64_t>(inputs, outputs, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims,
+                                                       src_blk_dims, src_blk_strides);
             case getPrecisionMask(Precision::I32, Precision::FP32):
-                return reduce_type<int32_t , float>(inputs, outputs, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims);
+                return reduce_type<int32_t , float>(inputs, outputs, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims,
+                                                       src_blk_dims, src_blk_strides);
             case getPrecisionMask(Precision::I32, Precision::I32):
-                return reduce_type<int32_t , int32_t>(inputs, outputs, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims);
+                return reduce_type<int32_t , int32_t>(inputs, outputs, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims,
+                                                       src_blk_dims, src_blk_strides);
             case getPrecisionMask(Precision::U8, Precision::U8):
-                return reduce_type<int8_t , int8_t>(inputs, outputs, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims);
+                return reduce_type<int8_t , int8_t>(inputs, outputs, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims,
+                                                       src_blk_dims, src_blk_strides);
             case getPrecisionMask(Precision::FP32, Precision::U8):
-                return reduce_type<float , uint8_t>(inputs, outputs, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims);
+                return reduce_type<float , uint8_t>(inputs, outputs, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims,
+                                                       src_blk_dims, src_blk_strides);
             default:
                 if (resp) {
                     std::string errorMsg = "Incorrect Reduce layer type";
@@ -165,20 +355,52 @@ public:
 private:
     template <typename src_d, typename dst_t, typename F1, typename F2>
     void reduce(const src_d *src_data, dst_t* dst_data, size_t work_amount_dst, size_t reduced_dims_work_amount,
-        SizeVector axes_for_reduction, SizeVector dst_dims, dst_t init_value, F1 func1, F2 func2);
+        SizeVector axes_for_reduction, SizeVector dst_dims, const SizeVector& blk_dims, const SizeVector& blk_strides,
+        dst_t init_value, F1 func1, F2 func2);
+    template <typename src_d, typename dst_t, typename F1, typename F2>
+    bool reduce_contiguous(const src_d *src_data, dst_t* dst_data, const SizeVector& axes_for_reduction,
+        const SizeVector& blk_dims, dst_t init_value, F1 func1, F2 func2);
     template <typename src_d, typename dst_t>
     StatusCode reduce_type(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, size_t work_amount_dst, size_t reduced_dims_work_amount,
-                SizeVector axes_for_reduction, SizeVector dst_dims);
+                SizeVector axes_for_reduction, SizeVector dst_dims, const SizeVector& blk_dims, const SizeVector& blk_strides);
     enum class Reduce { And, L1, L2, LogSum, LogSumExp, Max, Mean, Min, Or, Prod, Sum, SumSquare };
 
-    const size_t REDUCE_DATA = 0;
-    const size_t REDUCE_INDEXES = 1;
+    static bool getConstAxes(const CNNLayer* layer, SizeVector& axes) {
+        auto axesLayer = getCreatorLayer(layer->insData[REDUCE_INDEXES].lock()).lock();
+        if (!axesLayer || axesLayer->type != "Const" || axesLayer->blobs.find("custom") == axesLayer->blobs.end())
+            return false;
+        const auto& axesBlob = axesLayer->blobs.at("custom");
+        if (axesBlob->getTensorDesc().getPrecision() != Precision::I32)
+            return false;
+        const size_t rank = layer->insData[REDUCE_DATA].lock()->getTensorDesc().getDims().size();
+        const int32_t *axesData = axesBlob->cbuffer().as<const int32_t *>();
+        for (size_t i = 0; i < axesBlob->size(); i++) {
+            int32_t axis = axesData[i] < 0 ? axesData[i] + static_cast<int32_t>(rank) : axesData[i];
+            if (axis < 0 || static_cast<size_t>(axis) >= rank)
+                return false;
+            axes.push_back(static_cast<size_t>(axis));
+        }
+        return true;
+    }
+
+    template <cpu_isa_t isa>
+    void createKernels(jit_reduce_op op) {
+        reduce_kernel.reset(new jit_uni_reduce_kernel_f32<isa>({ op, false }));
+        reduce_vertical_kernel.reset(new jit_uni_reduce_kernel_f32<isa>({ op, true }));
+        kernel_step = cpu_isa_traits<isa>::vlen / sizeof(float);
+    }
+
+    static const size_t REDUCE_DATA = 0;
+    static const size_t REDUCE_INDEXES = 1;
     bool keep_dims = true;
     Reduce reduceMode = Reduce::Sum;
     SizeVector data_dims;
     SizeVector idx_dims;
     SizeVector src_dims;
-    SizeVector srcStrides;
+
+    std::shared_ptr<jit_uni_reduce_kernel> reduce_kernel;
+    std::shared_ptr<jit_uni_reduce_kernel> reduce_vertical_kernel;
+    size_t kernel_step = 1;
 };
 
 template <typename src_d, typename dst_t>
@@ -188,7 +410,9 @@ StatusCode ReduceImpl::reduce_type(
         size_t       work_amount_dst,
         size_t       reduced_dims_work_amount,
         SizeVector   axes_for_reduction,
-        SizeVector   our_dims
+        SizeVector   our_dims,
+        const SizeVector& blk_dims,
+        const SizeVector& blk_strides
 ) {
     const src_d *src_data = inputs[REDUCE_DATA]->cbuffer().as<src_d *>() +
                             inputs[REDUCE_DATA]->getTensorDesc().getBlockingDesc().getOffsetPadding();
@@ -197,17 +421,17 @@ StatusCode ReduceImpl::reduce_type(
 
     switch (reduceMode) {
         case Reduce::And:
-            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, static_cast<dst_t>(1),
+            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, blk_dims, blk_strides, static_cast<dst_t>(1),
                    [](dst_t x, src_d y)->dst_t { return x && y; },
                    [](dst_t x, src_d y)->dst_t { return x && y; });
             break;
         case Reduce::L1:
-            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, static_cast<dst_t>(0),
+            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, blk_dims, blk_strides, static_cast<dst_t>(0),
                    [](dst_t old, src_d y)->dst_t { return old + (std::abs)(y); },
                    [](dst_t x, src_d y)->dst_t { return x + y; });
             break;
         case Reduce::L2:
-            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, static_cast<dst_t>(0),
+            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, blk_dims, blk_strides, static_cast<dst_t>(0),
                    [](dst_t old, src_d y)->dst_t { return old + y * y;},
                    [](dst_t x, src_d y)->dst_t { return x + y; });
 
@@ -216,7 +440,7 @@ StatusCode ReduceImpl::reduce_type(
             });
             break;
         case Reduce::LogSum:
-            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, static_cast<dst_t>(0),
+            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, blk_dims, blk_strides, static_cast<dst_t>(0),
                    [](dst_t x, src_d y)->dst_t { return x + y; },
                    [](dst_t x, src_d y)->dst_t { return x + y; });
 
@@ -225,7 +449,7 @@ StatusCode ReduceImpl::reduce_type(
             });
             break;
         case Reduce::LogSumExp:
-            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, static_cast<dst_t>(0),
+            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, blk_dims, blk_strides, static_cast<dst_t>(0),
                    [](dst_t old, src_d y)->dst_t { return old + expf(y); },
                    [](dst_t x, src_d y)->dst_t { return x + y; });
 
@@ -234,13 +458,13 @@ StatusCode ReduceImpl::reduce_type(
             });
             break;
         case Reduce::Max:
-            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims,
-                                 (std::numeric_limits<dst_t>::min)(),
+            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, blk_dims, blk_strides,
+                                 std::numeric_limits<dst_t>::lowest(),
                    [](dst_t x, src_d y)->dst_t { return x > y ? x : y; },
                    [](dst_t x, src_d y)->dst_t { return x > y ? x : y; });
             break;
         case Reduce::Mean:
-            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, static_cast<dst_t>(0),
+            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, blk_dims, blk_strides, static_cast<dst_t>(0),
                    [](dst_t x, src_d y)->dst_t { return x + y; },
                    [](dst_t x, src_d y)->dst_t { return x + y; });
 
@@ -249,28 +473,28 @@ StatusCode ReduceImpl::reduce_type(
             });
             break;
         case Reduce::Min:
-            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims,
+            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, blk_dims, blk_strides,
                                  (std::numeric_limits<dst_t>::max)(),
                    [](dst_t x, src_d y)->dst_t { return x < y ? x : y; },
                    [](dst_t x, src_d y)->dst_t { return x < y ? x : y; });
             break;
         case Reduce::Or:
-            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, static_cast<dst_t>(0),
+            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, blk_dims, blk_strides, static_cast<dst_t>(0),
                    [](dst_t x, src_d y)->dst_t { return x || y; },
                    [](dst_t x, src_d y)->dst_t { return x || y; });
             break;
         case Reduce::Prod:
-            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, static_cast<dst_t>(1),
+            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, blk_dims, blk_strides, static_cast<dst_t>(1),
                    [](dst_t x, src_d y)->dst_t { return x * y; },
                    [](dst_t x, src_d y)->dst_t { return x * y; });
             break;
         case Reduce::Sum:
-            reduce(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, static_cast<dst_t>(0),
+            reduce(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, blk_dims, blk_strides, static_cast<dst_t>(0),
                    [](dst_t x, src_d y)->dst_t { return x + y; },
                    [](dst_t x, src_d y)->dst_t { return x + y; });
             break;
         case Reduce::SumSquare:
-            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, static_cast<dst_t>(0),
+            reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, blk_dims, blk_strides, static_cast<dst_t>(0),
                    [](dst_t old, src_d y)->dst_t { return old + y * y; },
                    [](dst_t x, src_d y)->dst_t { return x + y; });
             break;
@@ -288,10 +512,15 @@ void ReduceImpl::reduce(
     size_t       reduced_dims_work_amount,
     SizeVector   axes_for_reduction,
     SizeVector   dst_dims,
+    const SizeVector& blk_dims,
+    const SizeVector& blk_strides,
     dst_t        init_value,
     F1           func1,
     F2           func2
 ) {
+    if (reduce_contiguous(src_data, dst_data, axes_for_reduction, blk_dims, init_value, func1, func2))
+        return;
+
     unsigned int nthr = parallel_get_max_threads();
     if ((work_amount_dst + 1) >= nthr) {
         parallel_nt(0, [&](const int ithr, const int nthr) {
@@ -310,15 +539,15 @@ void ReduceImpl::reduce(
                 for (i = 0; i < reduced_dims_work_amount; ++i) {
                     if (update_idx) {
                         src_idx = 0;
-                        for (j = 0; j < static_cast<int>(src_dims.size()); ++j)
-                            src_idx += (src_counters[j] % src_dims[j]) * srcStrides[j];
+                        for (j = 0; j < static_cast<int>(blk_dims.size()); ++j)
+                            src_idx += (src_counters[j] % blk_dims[j]) * blk_strides[j];
                         update_idx = false;
                     }
                     reduce_prod = func1(reduce_prod, src_data[src_idx]);
                     for (j = axes_for_reduction.size() - 1; j >= 0; j--) {
                         src_counters[axes_for_reduction[j]]++;
-                        if (src_counters[axes_for_reduction[j]] < src_dims[axes_for_reduction[j]]) {
-                            src_idx += srcStrides[axes_for_reduction[j]];
+                        if (src_counters[axes_for_reduction[j]] < blk_dims[axes_for_reduction[j]]) {
+                            src_idx += blk_strides[axes_for_reduction[j]];
                             break;
                         } else {
                             src_counters[axes_for_reduction[j]] = 0;
@@ -341,7 +570,7 @@ void ReduceImpl::reduce(
         if (work_amount_dst == 1) {
             parallel_nt(nthr, [&](const int ithr, const int nthr) {
                 size_t i, start = 0, end = 0;
-                splitter((srcStrides[0] * src_dims[0]), nthr, ithr, start, end);
+                splitter((blk_strides[0] * blk_dims[0]), nthr, ithr, start, end);
                 for (i = start; i < end; ++i)
                     reduce_prod[ithr] = func1(reduce_prod[ithr], src_data[i]);
             });
@@ -353,11 +582,11 @@ void ReduceImpl::reduce(
                 int j;
                 bool update_idx = true;
                 size_t i, src_idx, dst_idx = 0, start = 0, end = 0;
-                splitter((srcStrides[0] * src_dims[0]), nthr, ithr, start, end);
-                SizeVector src_counters(src_dims.size(), 0);
-                for (j = src_dims.size() - 1, src_idx = start; j >= 0; j--) {
-                    src_counters[j] = src_idx % src_dims[j];
-                    src_idx /= src_dims[j];
+                splitter((blk_strides[0] * blk_dims[0]), nthr, ithr, start, end);
+                SizeVector src_counters(blk_dims.size(), 0);
+                for (j = blk_dims.size() - 1, src_idx = start; j >= 0; j--) {
+                    src_counters[j] = src_idx % blk_dims[j];
+                    src_idx /= blk_dims[j];
                 }
                 for (src_idx = start; src_idx < end; ++src_idx) {
                     if (update_idx) {
@@ -366,9 +595,9 @@ void ReduceImpl::reduce(
                         update_idx = false;
                     }
                     reduce_prod[ithr * work_amount_dst + dst_idx] = func1(reduce_prod[ithr * work_amount_dst + dst_idx], src_data[src_idx]);
-                    for (j = src_dims.size() - 1; j >= 0; j--) {
+                    for (j = blk_dims.size() - 1; j >= 0; j--) {
                         src_counters[j]++;
-                        if (src_counters[j] < src_dims[j]) {
+                        if (src_counters[j] < blk_dims[j]) {
                             if (dst_dims[j] > 1) dst_idx += dstStrides[j];
                             break;
                         } else {
@@ -387,6 +616,129 @@ void ReduceImpl::reduce(
     }
 }
 
+template <typename src_d, typename dst_t, typename F1, typename F2>
+bool ReduceImpl::reduce_contiguous(
+    const src_d *src_data,
+    dst_t       *dst_data,
+    const SizeVector& axes_for_reduction,
+    const SizeVector& blk_dims,
+    dst_t        init_value,
+    F1           func1,
+    F2           func2
+) {
+    // Collapse the tensor into [outer, reduced, inner] if the reduced axes are adjacent in memory
+    size_t outer = 1, reduced = 1, inner = 1;
+    enum { OUTER, REDUCED, INNER } part = OUTER;
+    for (size_t i = 0; i < blk_dims.size(); i++) {
+        if (blk_dims[i] == 1)
+            continue;
+        if (std::find(axes_for_reduction.begin(), axes_for_reduction.end(), i) != axes_for_reduction.end()) {
+            if (part == INNER)
+                return false;
+            part = REDUCED;
+            reduced *= blk_dims[i];
+        } else if (part == OUTER) {
+            outer *= blk_dims[i];
+        } else {
+            part = INNER;
+            inner *= blk_dims[i];
+        }
+    }
+
+    const bool use_jit = std::is_same<src_d, float>::value && std::is_same<dst_t, float>::value && reduce_kernel;
+    const size_t nthr = parallel_get_max_threads();
+    const size_t min_work_per_thread = 1024;
+
+    if (inner == 1) {
+        // every output is a reduction of a contiguous row
+        auto reduce_row = [&](const src_d *src, size_t len) -> dst_t {
+            dst_t result = init_value;
+            size_t i = 0;
+            if (use_jit && len >= kernel_step) {
+                float lanes[16];
+                std::fill(lanes, lanes + 16, static_cast<float>(init_value));
+                jit_reduce_call_args args;
+                args.src = reinterpret_cast<const float *>(src);
+                args.dst = lanes;
+                args.work_amount = len;
+                (*reduce_kernel)(&args);
+                for (size_t l = 0; l < kernel_step; l++)
+                    result = func2(result, static_cast<src_d>(lanes[l]));
+                i = len - len % kernel_step;
+            }
+            for (; i < len; i++)
+                result = func1(result, src[i]);
+            return result;
+        };
+
+        if (outer >= nthr || reduced < nthr * min_work_per_thread) {
+            parallel_for(outer, [&](size_t o) {
+                dst_data[o] = reduce_row(src_data + o * reduced, reduced);
+            });
+        } else {
+            // a few long rows, each of them is split between threads
+            std::vector<dst_t> partial(nthr, init_value);
+            for (size_t o = 0; o < outer; o++) {
+                parallel_nt(static_cast<int>(nthr), [&](const int ithr, const int nthr) {
+                    size_t start = 0, end = 0;
+                    splitter(reduced, nthr, ithr, start, end);
+                    partial[ithr] = reduce_row(src_data + o * reduced + start, end - start);
+                });
+                dst_t result = init_value;
+                for (size_t ithr = 0; ithr < nthr; ithr++)
+                    result = func2(result, partial[ithr]);
+                dst_data[o] = result;
+            }
+        }
+        return true;
+    }
+
+    // every output row is an element-wise reduction of contiguous input rows, the rows are
+    // processed by blocks to keep the accumulated part of the output in cache
+    auto reduce_rows = [&](dst_t *dst, const src_d *src, size_t rows, size_t len) {
+        std::fill(dst, dst + len, init_value);
+        for (size_t r = 0; r < rows; r++, src += inner) {
+            size_t i = 0;
+            if (use_jit) {
+                jit_reduce_call_args args;
+                args.src = reinterpret_cast<const float *>(src);
+                args.dst = reinterpret_cast<float *>(dst);
+                args.work_amount = len;
+                (*reduce_vertical_kernel)(&args);
+                i = len - len % kernel_step;
+            }
+            for (; i < len; i++)
+                dst[i] = func1(dst[i], src[i]);
+        }
+    };
+
+    const size_t inner_block = min_work_per_thread;
+    const size_t inner_blocks = div_up(inner, inner_block);
+    if (outer * inner_blocks >= nthr || reduced < nthr) {
+        parallel_for2d(outer, inner_blocks, [&](size_t o, size_t ib) {
+            const size_t start = ib * inner_block;
+            const size_t len = (std::min)(inner_block, inner - start);
+            reduce_rows(dst_data + o * inner + start, src_data + o * reduced * inner + start, reduced, len);
+        });
+    } else {
+        // too few output rows, the reduced rows are split between threads
+        std::vector<dst_t> partial(nthr * outer * inner, init_value);
+        parallel_nt(static_cast<int>(nthr), [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(reduced, nthr, ithr, start, end);
+            for (size_t o = 0; o < outer; o++)
+                reduce_rows(&partial[(ithr * outer + o) * inner], src_data + (o * reduced + start) * inner, end - start, inner);
+        });
+        parallel_for(outer * inner, [&](size_t i) {
+            dst_t result = init_value;
+            for (size_t ithr = 0; ithr < nthr; ithr++)
+                result = func2(result, partial[ithr * outer * inner + i]);
+            dst_data[i] = result;
+        });
+    }
+    return true;
+}
+
 REG_FACTORY_FOR(ReduceImpl, ReduceAnd);
 REG_FACTORY_FOR(ReduceImpl, ReduceL1);
 REG_FACTORY_FOR(ReduceImpl, ReduceL2);
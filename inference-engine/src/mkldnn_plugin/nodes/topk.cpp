@@ -11,6 +11,8 @@
 #include <vector>
 #include <cassert>
 #include <functional>
+#include <algorithm>
+#include <utility>
 #include "ie_parallel.hpp"
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
@@ -457,6 +459,112 @@ public:
         });
     }
 
+    typedef std::pair<float, int> topk_pair;
+
+    template <template <typename> class Compare>
+    struct better_pair {
+        //  Equal values are ordered by index, so the result doesn't depend on the selection algorithm
+        inline bool operator()(const topk_pair& a, const topk_pair& b) const {
+            return Compare<float>()(a.first, b.first) || (a.first == b.first && a.second < b.second);
+        }
+    };
+
+    struct lower_index {
+        inline bool operator()(const topk_pair& a, const topk_pair& b) const {
+            return a.second < b.second;
+        }
+    };
+
+    // Selects the best min(K, end - start) values of [start, end) part of the axis in arbitrary order
+    template <template <typename> class Compare>
+    int topk_select_part(const float* src, int start, int end, int stride, topk_pair* best) {
+        better_pair<Compare> better;
+        const int len = end - start;
+        const int k = std::min(src_k, len);
+        if (k <= 0)
+            return 0;
+
+        if (4 * k >= len) {
+            //  K is comparable with the length: partial sort of all the values
+            std::vector<topk_pair> all(len);
+            for (int i = 0; i < len; i++)
+                all[i] = topk_pair(src[(start + i) * stride], start + i);
+            std::nth_element(all.begin(), all.begin() + (k - 1), all.end(), better);
+            std::copy(all.begin(), all.begin() + k, best);
+        } else {
+            //  Heap of the best values seen so far with the worst of them on top
+            for (int i = 0; i < k; i++)
+                best[i] = topk_pair(src[(start + i) * stride], start + i);
+            std::make_heap(best, best + k, better);
+            for (int i = start + k; i < end; i++) {
+                topk_pair cur(src[i * stride], i);
+                if (better(cur, best[0])) {
+                    std::pop_heap(best, best + k, better);
+                    best[k - 1] = cur;
+                    std::push_heap(best, best + k, better);
+                }
+            }
+        }
+        return k;
+    }
+
+    // O(dim * log(K)) selection for large K, where the insertion above costs O(dim * K).
+    // When there are fewer rows than threads, the axis is split between threads as well
+    // and the best values of the parts are merged afterwards.
+    template <template <typename> class Compare>
+    void topk_select(const float* src_data, float* dst_data, int* dst_idx, SizeVector in_dims) {
+        const int after_num = count(in_dims, axis + 1, in_dims.size());
+        const int rows = before_num * after_num;
+        const int nthr = parallel_get_max_threads();
+        int n_parts = 1;
+        if (rows < nthr)
+            n_parts = std::max(1, std::min((nthr + rows - 1) / rows, dim / std::max(min_part_len, 4 * src_k)));
+        const int part_len = (dim + n_parts - 1) / n_parts;
+
+        std::vector<topk_pair> best(static_cast<size_t>(rows) * n_parts * src_k);
+        std::vector<int> best_num(static_cast<size_t>(rows) * n_parts, 0);
+
+        parallel_for2d(rows, n_parts, [&](int r, int p) {
+            const float* src = src_data + (r / after_num) * dim * after_num + r % after_num;
+            const int start = p * part_len;
+            const int end = std::min(dim, start + part_len);
+            if (start < end)
+                best_num[r * n_parts + p] = topk_select_part<Compare>(src, start, end, after_num, &best[(r * n_parts + p) * src_k]);
+        });
+
+        parallel_for(rows, [&](int r) {
+            topk_pair* row_best = &best[static_cast<size_t>(r) * n_parts * src_k];
+            int k = best_num[r * n_parts];
+            if (n_parts > 1) {
+                for (int p = 1; p < n_parts; p++) {
+                    const topk_pair* part_best = row_best + p * src_k;
+                    std::copy(part_best, part_best + best_num[r * n_parts + p], row_best + k);
+                    k += best_num[r * n_parts + p];
+                }
+                if (k > src_k) {
+                    std::nth_element(row_best, row_best + (src_k - 1), row_best + k, better_pair<Compare>());
+                    k = src_k;
+                }
+            }
+
+            if (sort_value)
+                std::sort(row_best, row_best + k, better_pair<Compare>());
+            else
+                std::sort(row_best, row_best + k, lower_index());
+
+            const int i0 = r / after_num;
+            const int i1 = r % after_num;
+            if (dst_data) {
+                for (int i2 = 0; i2 < k; i2++)
+                    dst_data[(i0 * src_k + i2) * after_num + i1] = row_best[i2].first;
+            }
+            if (dst_idx) {
+                for (int i2 = 0; i2 < k; i2++)
+                    dst_idx[(i0 * src_k + i2) * after_num + i1] = row_best[i2].second;
+            }
+        });
+    }
+
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         const float *src = inputs[TOPK_DATA]->cbuffer().as<float *>() +
             inputs[TOPK_DATA]->getTensorDesc().getBlockingDesc().getOffsetPadding();
@@ -511,7 +619,19 @@ public:
 
         SizeVector in_dims = inputs[TOPK_DATA]->getTensorDesc().getDims();
 
-        if (src_k == 1) {
+        //  Large K or a few long rows which have to be split between threads
+        int select_k = select_min_k;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        if (!is_last_dim)
+            select_k = std::max(select_k, count_vec);
+#endif
+        const int rows = before_num * count(in_dims, axis + 1, in_dims.size());
+        if (src_k >= select_k || (rows < parallel_get_max_threads() && dim >= 2 * min_part_len)) {
+            if (mode_max)
+                topk_select<std::greater>(src, dst_data, dst_idx, in_dims);
+            else
+                topk_select<std::less>(src, dst_data, dst_idx, in_dims);
+        } else if (src_k == 1) {
             if (is_last_dim) {
                 if (mode_max)
                     top1<std::greater>(src, dst_data, dst_idx, in_dims);
@@ -559,6 +679,11 @@ private:
 
     int dim, before_num;
 
+    //  K from which the heap or partial sort is used instead of the insertion
+    const int select_min_k = 16;
+    //  Minimal part of the axis worth a separate thread
+    const int min_part_len = 1024;
+
 #if defined(HAVE_AVX512F)
     const int count_vec = 32;
 #elif defined(HAVE_SSE) || defined(HAVE_AVX2)
@@ -4,34 +4,146 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define MKLDNN_PLUGIN_HAS_TSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define MKLDNN_PLUGIN_HAS_TSC
+#endif
 
 namespace MKLDNNPlugin {
 
-class PerfCount {
-    uint64_t duration;
-    uint32_t num;
+/**
+ * @brief Reads the cheapest monotonic clock of the platform: the time stamp counter on x86,
+ * nanoseconds of the steady clock otherwise. Use timestampsPerMicrosecond() to convert the difference.
+ */
+inline uint64_t readTimestamp() {
+#ifdef MKLDNN_PLUGIN_HAS_TSC
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+/**
+ * @brief Measures the rate of readTimestamp() against the steady clock. Only the first call of the process
+ * does the measurement and blocks for 10 ms, so it is made when a graph collecting counters is loaded.
+ */
+void calibrateTimestamps();
+
+/**
+ * @brief Returns the rate of readTimestamp() measured by calibrateTimestamps(), calibrates it if it was not yet
+ */
+double timestampsPerMicrosecond();
+
+/**
+ * @brief Ring buffer of the node executions of a single graph, the source of the chrome trace.
+ * The graph is executed by one stream at a time, so the buffer is written without any synchronization.
+ */
+class TraceBuffer {
+public:
+    struct Event {
+        uint32_t node;
+        uint64_t start;
+        uint64_t finish;
+    };
+
+    explicit TraceBuffer(size_t capacity): events(capacity) {}
+
+    void push(uint32_t node, uint64_t start, uint64_t finish) {
+        Event &event = events[next % events.size()];
+        event.node = node;
+        event.start = start;
+        event.finish = finish;
+        next++;
+    }
 
-    std::chrono::high_resolution_clock::time_point __start = {};
-    std::chrono::high_resolution_clock::time_point __finish = {};
+    /// Calls f for the recorded events from the oldest one
+    template <typename F>
+    void forEach(F f) const {
+        size_t first = next > events.size() ? next - events.size() : 0;
+        for (size_t i = first; i < next; i++)
+            f(events[i % events.size()]);
+    }
 
+private:
+    std::vector<Event> events;
+    size_t next = 0;
+};
+
+class PerfCount {
 public:
-    PerfCount(): duration(0), num(0) {}
+    // Bucket i counts the executions taking [2^i, 2^(i+1)) time stamps
+    static constexpr size_t histogramSize = 40;
+
+    PerfCount(): duration(0), num(0), hist{} {}
 
-    uint64_t avg() { return (num == 0) ? 0 : duration / num; }
+    /// Average execution time in microseconds
+    uint64_t avg() const { return (num == 0) ? 0 : static_cast<uint64_t>(duration / timestampsPerMicrosecond() / num); }
+
+    uint64_t count() const { return num; }
+    uint64_t totalTimestamps() const { return duration; }
+    const std::array<uint32_t, histogramSize>& histogram() const { return hist; }
+
+    /// Bytes read and written and operations done by the node per execution
+    void setWorkload(uint64_t nodeBytes, uint64_t nodeFlops) {
+        bytes = nodeBytes;
+        flops = nodeFlops;
+    }
+    uint64_t getBytes() const { return bytes; }
+    uint64_t getFlops() const { return flops; }
+
+    /// Records every execution into the trace under the given id as well
+    void setTrace(TraceBuffer *buffer, uint32_t id) {
+        trace = buffer;
+        traceId = id;
+    }
 
 private:
     void start_itr() {
-        __start = std::chrono::high_resolution_clock::now();
+        __start = readTimestamp();
     }
 
     void finish_itr() {
-        __finish = std::chrono::high_resolution_clock::now();
+        __finish = readTimestamp();
 
-        duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        uint64_t d = __finish - __start;
+        duration += d;
         num++;
+        hist[bucket(d)]++;
+        if (trace)
+            trace->push(traceId, __start, __finish);
     }
 
+    static size_t bucket(uint64_t d) {
+        size_t b = 0;
+#if defined(__GNUC__)
+        b = d ? 63 - __builtin_clzll(d) : 0;
+#else
+        while (d >>= 1) b++;
+#endif
+        return b < histogramSize ? b : histogramSize - 1;
+    }
+
+    uint64_t duration;
+    uint64_t num;
+    std::array<uint32_t, histogramSize> hist;
+    uint64_t bytes = 0;
+    uint64_t flops = 0;
+
+    TraceBuffer *trace = nullptr;
+    uint32_t traceId = 0;
+
+    uint64_t __start = 0;
+    uint64_t __finish = 0;
+
     friend class PerfHelper;
 };
 
@@ -12,8 +12,10 @@
 #include <cpp_interfaces/exception2status.hpp>
 #include <ie_system_conf.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <exception>
-#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -41,8 +43,6 @@ namespace InferenceEngine {
  */
 class AsyncInferRequestThreadSafeDefault : public AsyncInferRequestThreadSafeInternal {
     using AtomicCallback = std::atomic<IInferRequest::CompletionCallback>;
-    using Futures = std::vector<std::shared_future<void>>;
-    using Promise = std::shared_ptr<std::promise<void>>;
     enum Stage_e : std::uint8_t { executor, task };
     struct DisableCallbackGuard{
         explicit DisableCallbackGuard(AtomicCallback& callback)
@@ -98,37 +98,43 @@ public:
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str + "Timeout can't be less "
                                << IInferRequest::WaitMode::RESULT_READY << " for InferRequest::Wait\n";
         }
-        auto status = std::future_status::deferred;
-
-        // Just use the last '_futures' member to wait pipeline completion
-        auto future = [&] {
-            std::lock_guard<std::mutex> lock {_mutex};
-            return _futures.empty() ? std::shared_future<void> {} : _futures.back();
-        }();
-
-        if (!future.valid()) {
+        // Just wait for the last started pipeline
+        const auto pipeline = _startedPipelines.load();
+        if (0 == pipeline) {
             return StatusCode::INFER_NOT_STARTED;
         }
 
-        switch (millis_timeout) {
-        case IInferRequest::WaitMode::RESULT_READY: {
-            future.wait();
-            status = std::future_status::ready;
-        } break;
-        case IInferRequest::WaitMode::STATUS_ONLY: {
-            status = future.wait_for(std::chrono::milliseconds {0});
-        } break;
-        default: {
-            status = future.wait_for(std::chrono::milliseconds {millis_timeout});
-        } break;
+        // The pipeline has already finished: no locking
+        if (_finishedPipelines.load(std::memory_order_acquire) < pipeline) {
+            if (IInferRequest::WaitMode::STATUS_ONLY == millis_timeout) {
+                return StatusCode::RESULT_NOT_READY;
+            }
+            std::unique_lock<std::mutex> lock {_mutex};
+            auto finished = [&] {
+                return _finishedPipelines.load(std::memory_order_relaxed) >= pipeline;
+            };
+            bool ready = true;
+            ++_waiters;
+            if (IInferRequest::WaitMode::RESULT_READY == millis_timeout) {
+                _completed.wait(lock, finished);
+            } else {
+                ready = _completed.wait_for(lock, std::chrono::milliseconds {millis_timeout}, finished);
+            }
+            --_waiters;
+            if (!ready) {
+                return StatusCode::RESULT_NOT_READY;
+            }
         }
 
-        if (std::future_status::ready == status) {
-            future.get();
-            return StatusCode::OK;
-        } else {
-            return StatusCode::RESULT_NOT_READY;
+        if (_failedPipeline.load(std::memory_order_acquire) == pipeline) {
+            std::exception_ptr exception;
+            {
+                std::lock_guard<std::mutex> lock {_mutex};
+                exception = _failedPipelineException;
+            }
+            std::rethrow_exception(exception);
         }
+        return StatusCode::OK;
     }
 
     /**
@@ -151,44 +157,32 @@ protected:
     using Pipeline = std::vector<Stage>;
 
     /**
-     * @brief Creates and run the first stage task. If destructor was not called add a new std::future to the
-     * AsyncInferRequestThreadSafeDefault::_futures list that would be used to wait
-     * AsyncInferRequestThreadSafeDefault::_pipeline finish
+     * @brief Creates and run the first stage task. If destructor was not called the pipeline is counted as started,
+     * AsyncInferRequestThreadSafeDefault::Wait waits for the last started pipeline to finish.
+     * @note Only one pipeline runs at a time: the request is busy until the last stage, so the state
+     * of the running pipeline is kept in members and the stage tasks do not allocate
      * @param[in]  itBeginStage Iterator to begin of pipeline
      * @param[in]  itEndStage End pipeline iterator
      * @param[in]  callbackExecutor Final or error stage executor
      */
     void RunFirstStage(const Pipeline::iterator itBeginStage, const Pipeline::iterator itEndStage,
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
-        _promise = {};
-        bool stop = [&] {
-            std::lock_guard<std::mutex> lock(_mutex);
-            if (!_stop) {
-                _futures.erase(std::remove_if(std::begin(_futures), std::end(_futures),
-                                              [](const std::shared_future<void>& future) {
-                                                  if (future.valid()) {
-                                                      return (std::future_status::ready ==
-                                                              future.wait_for(std::chrono::milliseconds {0}));
-                                                  } else {
-                                                      return true;
-                                                  }
-                                              }),
-                               _futures.end());
-
-                _futures.emplace_back(_promise.get_future().share());
-            }
-            return _stop;
-        }();
-
-        if (!stop) {
-            try {
-                auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
-                IE_ASSERT(nullptr != firstStageExecutor);
-                firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
-            } catch (...) {
-                _promise.set_exception(std::current_exception());
-                throw;
-            }
+        const auto pipeline = _startedPipelines.fetch_add(1) + 1;
+        if (_stop) {
+            FinishPipeline(pipeline, nullptr);
+            return;
+        }
+
+        _runningPipeline = pipeline;
+        _itEndStage = itEndStage;
+        _lastStageExecutor = callbackExecutor;
+        try {
+            auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
+            IE_ASSERT(nullptr != firstStageExecutor);
+            firstStageExecutor->run(MakeNextStageTask(itBeginStage));
+        } catch (...) {
+            FinishPipeline(pipeline, std::current_exception());
+            throw;
         }
     }
 
@@ -199,17 +193,13 @@ protected:
      */
     void StopAndWait() {
         _callback = nullptr;
-        {
-            std::lock_guard<std::mutex> lock(_mutex);
-            if (!_stop) {
-                _stop = true;
-                for (auto&& future : _futures) {
-                    if (future.valid()) {
-                        future.wait();
-                    }
-                }
-            }
-        }
+        _stop = true;
+        std::unique_lock<std::mutex> lock {_mutex};
+        ++_waiters;
+        _completed.wait(lock, [&] {
+            return _finishedPipelines.load() == _startedPipelines.load();
+        });
+        --_waiters;
     }
 
     /**
@@ -286,79 +276,123 @@ protected:
 private:
     /**
      * @brief Create a task with next pipeline stage.
-     * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
-     * On last stage or if the exception is raised from `_pipeline` task
-     * the last stage task is called or passed to callback executor if it is presented. The last stage task call the
-     * callback, if it is presented, capture the `_promise` member and use it to forward completion or exception to the
-     * one of `_futures` member
+     * The task captures only `this` and the stage iterator, so it fits into the small buffer of @ref Task
+     * and doesn't allocate.
      * @param[in]  itStage Iterator to next stage of pipeline
-     * @param[in]  itEndStage End pipeline iterator
-     * @param[in]  callbackExecutor Executor that will run final stage with callback call
      * @return A next stage task
      */
-    Task MakeNextStageTask(const Pipeline::iterator itStage, const Pipeline::iterator itEndStage,
-                           const ITaskExecutor::Ptr callbackExecutor) {
-        return std::bind([this, itStage, itEndStage](ITaskExecutor::Ptr& callbackExecutor) mutable {
-            StatusCode requestStatus = StatusCode::OK;
-            std::exception_ptr localCurrentException = nullptr;
-            auto& thisStage = *itStage;
-            auto itNextStage = itStage + 1;
-
-            try {
-                auto& stageTask = std::get<Stage_e::task>(thisStage);
-                IE_ASSERT(nullptr != stageTask);
-                stageTask();
-               if (itEndStage != itNextStage) {
-                    auto& nextStage = *itNextStage;
-                    auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
-                    IE_ASSERT(nullptr != nextStageExecutor);
-                    nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
-                }
-            } catch (InferenceEngine::details::InferenceEngineException& ie_ex) {
-                requestStatus = ie_ex.hasStatus() ? ie_ex.getStatus() : StatusCode::GENERAL_ERROR;
-                localCurrentException = std::make_exception_ptr(ie_ex);
-            } catch (...) {
-                requestStatus = StatusCode::GENERAL_ERROR;
-                localCurrentException = std::current_exception();
+    Task MakeNextStageTask(const Pipeline::iterator itStage) {
+        return [this, itStage] {
+            RunStage(itStage);
+        };
+    }
+
+    /**
+     * @brief Runs the pipeline stage and passes the next one to its executor.
+     * On last stage or if the exception is raised from `_pipeline` task the last stage is called
+     * or passed to the callback executor if it is presented.
+     * @param[in]  itStage Iterator to the stage of pipeline
+     */
+    void RunStage(const Pipeline::iterator itStage) {
+        StatusCode requestStatus = StatusCode::OK;
+        std::exception_ptr localCurrentException = nullptr;
+        auto itNextStage = itStage + 1;
+        // The members may be changed by the next pipeline once the next stage is passed to the executor
+        const bool isLastStage = (_itEndStage == itNextStage);
+
+        try {
+            auto& stageTask = std::get<Stage_e::task>(*itStage);
+            IE_ASSERT(nullptr != stageTask);
+            stageTask();
+            if (!isLastStage) {
+                auto& nextStageExecutor = std::get<Stage_e::executor>(*itNextStage);
+                IE_ASSERT(nullptr != nextStageExecutor);
+                nextStageExecutor->run(MakeNextStageTask(itNextStage));
             }
+        } catch (InferenceEngine::details::InferenceEngineException& ie_ex) {
+            requestStatus = ie_ex.hasStatus() ? ie_ex.getStatus() : StatusCode::GENERAL_ERROR;
+            localCurrentException = std::make_exception_ptr(ie_ex);
+        } catch (...) {
+            requestStatus = StatusCode::GENERAL_ERROR;
+            localCurrentException = std::current_exception();
+        }
 
-            if ((itEndStage == itNextStage) || (nullptr != localCurrentException)) {
-                auto lastStageTask = [this, requestStatus, localCurrentException]() mutable {
-                    auto promise = std::move(_promise);
-                    auto callback = _callback.load();
-                    if (setIsRequestBusy(false)) {
-                        if (nullptr != callback) {
-                            InferenceEngine::CurrentException() = localCurrentException;
-                            try {
-                                callback(_publicInterface, requestStatus);
-                            } catch (...) {
-                                localCurrentException = std::current_exception();
-                            }
-                            InferenceEngine::CurrentException() = nullptr;
-                        }
-                        if (nullptr == localCurrentException) {
-                            promise.set_value();
-                        } else {
-                            promise.set_exception(localCurrentException);
-                        }
-                    }
-                };
-
-                if (nullptr == callbackExecutor) {
-                    lastStageTask();
-                } else {
-                    callbackExecutor->run(std::move(lastStageTask));
+        if (isLastStage || (nullptr != localCurrentException)) {
+            _requestStatus = requestStatus;
+            _requestException = std::move(localCurrentException);
+            auto lastStageExecutor = _lastStageExecutor;
+            if (nullptr == lastStageExecutor) {
+                RunLastStage();
+            } else {
+                lastStageExecutor->run([this] {
+                    RunLastStage();
+                });
+            }
+        }
+    }
+
+    /**
+     * @brief Calls the callback, if it is presented, and forwards completion or exception of the pipeline to
+     * AsyncInferRequestThreadSafeDefault::Wait
+     */
+    void RunLastStage() {
+        // The callback may start the next pipeline, so the state of this one is taken first
+        const auto pipeline = _runningPipeline;
+        const auto requestStatus = _requestStatus;
+        auto localCurrentException = std::move(_requestException);
+        _requestException = nullptr;
+        auto callback = _callback.load();
+        if (setIsRequestBusy(false)) {
+            if (nullptr != callback) {
+                InferenceEngine::CurrentException() = localCurrentException;
+                try {
+                    callback(_publicInterface, requestStatus);
+                } catch (...) {
+                    localCurrentException = std::current_exception();
                 }
+                InferenceEngine::CurrentException() = nullptr;
             }
-        }, std::move(callbackExecutor));
+        }
+        FinishPipeline(pipeline, std::move(localCurrentException));
+    }
+
+    /**
+     * @brief Marks the pipeline as finished and wakes up the waiting threads if there are any.
+     * The request must not be used after the mutex is released: the destructor may proceed then.
+     * @param[in]  pipeline The number of the pipeline
+     * @param[in]  exception The exception raised by the pipeline or `nullptr`
+     */
+    void FinishPipeline(const std::uint64_t pipeline, std::exception_ptr exception) {
+        std::lock_guard<std::mutex> lock {_mutex};
+        if (nullptr != exception) {
+            _failedPipelineException = std::move(exception);
+            _failedPipeline.store(pipeline, std::memory_order_release);
+        }
+        _finishedPipelines.fetch_add(1, std::memory_order_release);
+        if (_waiters > 0) {
+            _completed.notify_all();
+        }
     }
 
     void* _userData = nullptr;
     AtomicCallback _callback = {nullptr};
     IInferRequest::Ptr _publicInterface;
-    std::promise<void> _promise;
+
+    // The running pipeline
+    std::uint64_t _runningPipeline = 0;
+    Pipeline::iterator _itEndStage;
+    ITaskExecutor::Ptr _lastStageExecutor;
+    StatusCode _requestStatus = StatusCode::OK;
+    std::exception_ptr _requestException;
+
+    // Numbers of started and finished pipelines, the pipelines are numbered from 1
+    std::atomic<std::uint64_t> _startedPipelines = {0};
+    std::atomic<std::uint64_t> _finishedPipelines = {0};
+    std::atomic<std::uint64_t> _failedPipeline = {0};
+    std::exception_ptr _failedPipelineException;
     mutable std::mutex _mutex;
-    Futures _futures;
-    bool _stop = false;
+    std::condition_variable _completed;
+    int _waiters = 0;
+    std::atomic<bool> _stop = {false};
 };
 }  // namespace InferenceEngine
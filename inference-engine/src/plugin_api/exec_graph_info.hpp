@@ -46,6 +46,12 @@ static const char IMPL_TYPE[] = "primitiveType";
  */
 static const char OUTPUT_PRECISIONS[] = "outputPrecisions";
 
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get a precision the executable primitive computes in.
+ */
+static const char RUNTIME_PRECISION[] = "runtimePrecision";
+
 /**
  * @ingroup ie_dev_exec_graph
  * @brief Used to get a value of execution time of the executable primitive.
@@ -78,6 +84,7 @@ static const char LAYER_TYPE[] = "layerType";
  * - ExecGraphInfoSerialization::ORIGINAL_NAMES
  * - ExecGraphInfoSerialization::IMPL_TYPE
  * - ExecGraphInfoSerialization::OUTPUT_PRECISIONS
+ * - ExecGraphInfoSerialization::RUNTIME_PRECISION
  * - ExecGraphInfoSerialization::PERF_COUNTER
  * - ExecGraphInfoSerialization::OUTPUT_LAYOUTS
  * - ExecGraphInfoSerialization::EXECUTION_ORDER
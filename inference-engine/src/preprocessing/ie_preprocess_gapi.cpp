@@ -170,6 +170,29 @@ std::vector<std::vector<cv::gapi::own::Mat>> bind_to_blob(const I420Blob::Ptr& i
     return batched_input_plane_mats;
 }
 
+// BatchedBlob of NV12Blob or I420Blob frames: every frame is a separate compound blob while the
+// whole batch is processed by the same graph
+template<typename FrameBlob>
+struct BatchedFrames {
+    BatchedBlob::Ptr blob;
+
+    std::shared_ptr<FrameBlob> frame(size_t i) const {
+        return as<FrameBlob>(blob->getBlob(i));
+    }
+};
+
+template<typename FrameBlob>
+std::vector<std::vector<cv::gapi::own::Mat>> bind_to_blob(const BatchedFrames<FrameBlob>& inBlob,
+                                                          int batch_size) {
+    std::vector<std::vector<cv::gapi::own::Mat>> batched_input_plane_mats(batch_size);
+    for (int i = 0; i < batch_size; ++i) {
+        auto frame_plane_mats = bind_to_blob(inBlob.frame(i), 1);
+        batched_input_plane_mats[i] = std::move(frame_plane_mats[0]);
+    }
+
+    return batched_input_plane_mats;
+}
+
 template<typename... Ts, int... IIs>
 std::vector<cv::GMat> to_vec_impl(std::tuple<Ts...> &&gmats, cv::detail::Seq<IIs...>) {
     return { std::get<IIs>(gmats)... };
@@ -350,6 +373,17 @@ void validateBlob(const I420Blob::Ptr &inBlob) {
     validateTensorDesc(v_blob->getTensorDesc());
 }
 
+template<typename FrameBlob>
+void validateBlob(const BatchedFrames<FrameBlob> &inBlob) {
+    for (size_t i = 0; i < inBlob.blob->size(); ++i) {
+        const auto frame = inBlob.frame(i);
+        if (!frame) {
+            THROW_IE_EXCEPTION << "Invalid underlying blobs in BatchedBlob";
+        }
+        validateBlob(frame);
+    }
+}
+
 const std::pair<const TensorDesc&, Layout> getTensorDescAndLayout(const MemoryBlob::Ptr &blob) {
     const auto& desc =  blob->getTensorDesc();
     return {desc, desc.getLayout()};
@@ -366,6 +400,12 @@ const std::pair<const TensorDesc&, Layout> getTensorDescAndLayout(const I420Blob
     return {blob->y()->getTensorDesc(), Layout::NCHW};
 }
 
+// BatchedBlob descriptor is the Y plane descriptor with the batch set to the number of frames
+template<typename FrameBlob>
+const std::pair<const TensorDesc&, Layout> getTensorDescAndLayout(const BatchedFrames<FrameBlob> &blob) {
+    return {blob.blob->getTensorDesc(), Layout::NCHW};
+}
+
 G::Desc getGDesc(G::Desc in_desc_y, const NV12Blob::Ptr &) {
     auto nv12_desc = G::Desc{};
     nv12_desc.d = in_desc_y.d;
@@ -386,6 +426,11 @@ G::Desc getGDesc(G::Desc in_desc_y, const MemoryBlob::Ptr &) {
     return in_desc_y;
 }
 
+template<typename FrameBlob>
+G::Desc getGDesc(G::Desc in_desc_y, const BatchedFrames<FrameBlob> &blob) {
+    return getGDesc(in_desc_y, blob.frame(0));
+}
+
 class PlanarColorConversions {
     using GMats = std::vector<cv::GMat>;
     using CvtFunction = std::function<GMats(const GMats&, Layout, Layout, ResizeAlgorithm)>;
@@ -740,10 +785,13 @@ bool PreprocEngine::useGAPI() {
 void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst) {
     // Note: src blob is the ROI blob, dst blob is the network's input blob
 
-    // src is either a memory blob, an NV12, or an I420 blob
-    const bool yuv420_blob = src->is<NV12Blob>() || src->is<I420Blob>();
-    if (!src->is<MemoryBlob>() && !yuv420_blob) {
-        THROW_IE_EXCEPTION  << "Unsupported input blob type: expected MemoryBlob, NV12Blob or I420Blob";
+    // src is either a memory blob, an NV12, an I420 blob or a batch of NV12 or I420 blobs
+    const auto batched_blob = as<BatchedBlob>(src);
+    const auto frame = batched_blob ? batched_blob->getBlob(0) : src;
+    const bool yuv420_blob = frame->is<NV12Blob>() || frame->is<I420Blob>();
+    if ((batched_blob && !yuv420_blob) || (!src->is<MemoryBlob>() && !yuv420_blob)) {
+        THROW_IE_EXCEPTION  << "Unsupported input blob type: expected MemoryBlob, NV12Blob, I420Blob "
+                               "or BatchedBlob of NV12Blob or I420Blob";
     }
 
     // dst is always a memory blob
@@ -778,7 +826,17 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
         THROW_IE_EXCEPTION << "Input pre-processing is called with invalid batch size " << batch;
     }
 
-    if (blob->is<CompoundBlob>()) {
+    if (blob->is<BatchedBlob>()) {
+        // every frame of a batched blob is a separate blob
+        const auto frames = static_cast<int>(blob->size());
+        if (batch > frames) {
+            THROW_IE_EXCEPTION  << "Provided batch size " << batch
+                                << " exceeds the number of blobs in BatchedBlob: " << frames;
+        }
+        if (batch < 0) {
+            batch = frames;
+        }
+    } else if (blob->is<CompoundBlob>()) {
         // batch size must always be 1 in compound blob case
         if (batch > 1) {
             THROW_IE_EXCEPTION  << "Provided input blob batch size " << batch
@@ -971,6 +1029,14 @@ bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
     // if input color format is not NV12, a MemoryBlob is expected. otherwise, NV12Blob is expected
     switch (in_fmt) {
     case ColorFormat::NV12: {
+        if (auto inBatchedBlob = as<BatchedBlob>(inBlob)) {
+            if (!inBatchedBlob->getBlob(0)->is<NV12Blob>()) {
+                THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
+                                    << ": expected BatchedBlob of NV12Blob";
+            }
+            return preprocessBlob(BatchedFrames<NV12Blob>{inBatchedBlob}, outMemoryBlob, algorithm,
+                in_fmt, out_fmt, omp_serial, batch_size);
+        }
         auto inNV12Blob = as<NV12Blob>(inBlob);
         if (!inNV12Blob) {
             THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
@@ -980,6 +1046,14 @@ bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
             batch_size);
     }
     case ColorFormat::I420: {
+        if (auto inBatchedBlob = as<BatchedBlob>(inBlob)) {
+            if (!inBatchedBlob->getBlob(0)->is<I420Blob>()) {
+                THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
+                                    << ": expected BatchedBlob of I420Blob";
+            }
+            return preprocessBlob(BatchedFrames<I420Blob>{inBatchedBlob}, outMemoryBlob, algorithm,
+                in_fmt, out_fmt, omp_serial, batch_size);
+        }
         auto inI420Blob = as<I420Blob>(inBlob);
         if (!inI420Blob) {
             THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
@@ -3,15 +3,22 @@
 //
 
 #include "ie_ir_parser.hpp"
+#include "ie_ir_itt.hpp"
 
 #include <ie_memcpy.h>
+#include <ie_parallel.hpp>
 
 #include <typeinfo>
+#include <unordered_map>
 #include <unordered_set>
 #include <algorithm>
+#include <cstring>
 #include <deque>
+#include <exception>
+#include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <ngraph/ngraph.hpp>
 #include <set>
 #include <sstream>
@@ -64,6 +71,76 @@ public:
         originBlob(weights) { }
 };
 
+/**
+ * Keeps created Constants and returns the already created Constant with the same element type,
+ * shape and data instead of a new one, so identical constants share one buffer
+ */
+class ConstantsCache {
+    std::unordered_multimap<size_t, std::shared_ptr<ngraph::op::Constant>> constants;
+
+    static size_t getByteSize(const ngraph::op::Constant& constant) {
+        return (ngraph::shape_size(constant.get_shape()) * constant.get_element_type().bitwidth() + 7) / 8;
+    }
+
+    static size_t hash(const ngraph::op::Constant& constant) {
+        uint64_t seed = 0;
+        const auto combine = [&seed](uint64_t value) {
+            seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        };
+        combine(constant.get_element_type().hash());
+        for (const auto dim : constant.get_shape())
+            combine(dim);
+
+        // Only the head and the tail of the data are hashed, so large constants are not read as a whole
+        // (a serial hash costs ~0.3 s per GB). The full data is compared only when the hashes match.
+        const auto data = reinterpret_cast<const uint8_t*>(constant.get_data_ptr());
+        const size_t size = getByteSize(constant);
+        const size_t sampleSize = 4096;
+        const auto combineRange = [&](size_t begin, size_t end) {
+            size_t i = begin;
+            for (; i + sizeof(uint64_t) <= end; i += sizeof(uint64_t)) {
+                uint64_t word;
+                std::memcpy(&word, data + i, sizeof(word));
+                combine(word);
+            }
+            for (; i < end; i++)
+                combine(data[i]);
+        };
+        if (size <= 2 * sampleSize) {
+            combineRange(0, size);
+        } else {
+            combineRange(0, sampleSize);
+            combineRange(size - sampleSize, size);
+        }
+        return static_cast<size_t>(seed);
+    }
+
+public:
+    std::shared_ptr<ngraph::op::Constant> share(const std::shared_ptr<ngraph::op::Constant>& constant) {
+        const size_t key = hash(*constant);
+        const auto range = constants.equal_range(key);
+        for (auto it = range.first; it != range.second; ++it) {
+            const auto& cached = it->second;
+            if (cached->get_element_type() == constant->get_element_type() &&
+                cached->get_shape() == constant->get_shape() &&
+                !std::memcmp(cached->get_data_ptr(), constant->get_data_ptr(), getByteSize(*constant)))
+                return cached;
+        }
+        constants.emplace(key, constant);
+        return constant;
+    }
+};
+
+/**
+ * Types of the layers whose constant inputs the low precision transformations can modify in place after
+ * the conversion to CNNNetwork
+ */
+const std::unordered_set<std::string> modifiableConstConsumers = {
+    "FakeQuantize", "Convolution", "GroupConvolution", "ConvolutionBackpropData", "GroupConvolutionBackpropData",
+    "DeformableConvolution", "BinaryConvolution", "MatMul", "Add", "Subtract", "Multiply", "PRelu",
+    "LSTMCell", "GRUCell", "RNNCell", "LSTMSequence", "GRUSequence", "RNNSequence"
+};
+
 V10Parser::V10Parser(const std::vector<IExtensionPtr>& exts) {
     // Load default opsets
     opsets["opset1"] = ngraph::get_opset1();
@@ -87,48 +164,111 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, std::i
         pugi::xml_node xml;
         GenericLayerParams params;
     };
-    std::map<size_t, node_params> params;
+    // Layers are addressed by their position in <layers>, fromLayerIdx is the position of the source layer
+    using edge = struct { size_t fromLayerId, fromLayerIdx, fromPortId, toPortId; };
+    const size_t invalidIdx = std::numeric_limits<size_t>::max();
 
+    std::vector<node_params> params;
+    std::unordered_map<size_t, size_t> id_to_idx;
     std::vector<size_t> outputs;
-    std::unordered_set<std::string> opName;
-
-    // Read all layers and store their parameters in params map
-    FOREACH_CHILD(node, root.child("layers"), "layer") {
-        auto node_param = parseGenericParams(node);
-        if (opName.find(node_param.name) != opName.end())
-            THROW_IE_EXCEPTION << "Invalid IR! " << node_param.name << " name is not unique!";
-        opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
-        if (node_param.type == "Result" || node_param.type == "Assign") {
-            outputs.push_back(node_param.layerId);
+    // The low precision transformations run only for quantized networks
+    bool quantized = false;
+
+    // Read all layers and store their parameters
+    {
+        OV_ITT_SCOPED_TASK(itt::domains::V10Reader, "V10Parser::parse::layers");
+        FOREACH_CHILD(node, root.child("layers"), "layer") {
+            params.push_back({node, {}});
         }
-    }
 
-    using edge = struct { size_t fromLayerId, fromPortId, toPortId; };
-    std::map<size_t, std::vector<edge>> edges;
-    std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
+        // Layers are parsed independently, the DOM is only read here
+        std::mutex errorMutex;
+        std::exception_ptr error;
+        parallel_for(params.size(), [&](size_t i) {
+            try {
+                params[i].params = parseGenericParams(params[i].xml);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+        });
+        if (error)
+            std::rethrow_exception(error);
+
+        std::unordered_set<std::string> opName;
+        opName.reserve(params.size());
+        id_to_idx.reserve(params.size());
+        for (size_t i = 0; i < params.size(); i++) {
+            const auto& node_param = params[i].params;
+            if (!opName.insert(node_param.name).second)
+                THROW_IE_EXCEPTION << "Invalid IR! " << node_param.name << " name is not unique!";
+            id_to_idx[node_param.layerId] = i;
+            if (node_param.type == "Result" || node_param.type == "Assign") {
+                outputs.push_back(i);
+            }
+            quantized |= node_param.type == "FakeQuantize";
+        }
+    }
 
     // Read all edges and store them for further usage
-    FOREACH_CHILD(_ec, root.child("edges"), "edge") {
-        size_t fromLayer = GetUIntAttr(_ec, "from-layer");
-        size_t fromPort = GetUIntAttr(_ec, "from-port");
-        size_t toLayer = GetUIntAttr(_ec, "to-layer");
-        size_t toPort = GetUIntAttr(_ec, "to-port");
-        edges[toLayer].push_back({fromLayer, fromPort, toPort});
+    std::vector<std::vector<edge>> edges(params.size());
+    std::unordered_set<size_t> uniqueConstants;
+    {
+        OV_ITT_SCOPED_TASK(itt::domains::V10Reader, "V10Parser::parse::edges");
+        FOREACH_CHILD(_ec, root.child("edges"), "edge") {
+            size_t fromLayer = GetUIntAttr(_ec, "from-layer");
+            size_t fromPort = GetUIntAttr(_ec, "from-port");
+            size_t toLayer = GetUIntAttr(_ec, "to-layer");
+            size_t toPort = GetUIntAttr(_ec, "to-port");
+            auto to = id_to_idx.find(toLayer);
+            if (to == id_to_idx.end())
+                continue;
+            auto from = id_to_idx.find(fromLayer);
+            edges[to->second].push_back({fromLayer, from != id_to_idx.end() ? from->second : invalidIdx, fromPort, toPort});
+
+            // Constants which are network outputs or initialize states keep their own names. In quantized
+            // networks weights, biases and quantization intervals are not merged either: after the conversion
+            // to CNNNetwork they become blobs which the low precision transformations modify in place for
+            // a single consumer.
+            const auto& toType = params[to->second].params.type;
+            if (from != id_to_idx.end() && (toType == "Result" || toType == "ReadValue" || toType == "Assign" ||
+                                            (quantized && modifiableConstConsumers.count(toType))))
+                uniqueConstants.insert(from->second);
+        }
     }
 
-    // Run DFS starting from outputs to get nodes topological order
-    std::set<size_t> used;
+    // Run DFS starting from outputs to get nodes topological order.
+    // The traversal is iterative, deep IRs would overflow the stack with recursion.
     std::vector<size_t> order;
-    std::function<void(size_t)> dfs = [&edges, &order, &used, &dfs](const size_t id) {
-        if (used.count(id)) return;
-        used.insert(id);
-        for (auto& edge : edges[id]) {
-            dfs(edge.fromLayerId);
+    {
+        OV_ITT_SCOPED_TASK(itt::domains::V10Reader, "V10Parser::parse::order");
+        order.reserve(params.size());
+        std::vector<bool> used(params.size(), false);
+        // layer position and the number of already visited input edges
+        std::vector<std::pair<size_t, size_t>> stack;
+        for (const auto output : outputs) {
+            if (used[output])
+                continue;
+            used[output] = true;
+            stack.emplace_back(output, 0);
+            while (!stack.empty()) {
+                const size_t idx = stack.back().first;
+                const size_t visited = stack.back().second;
+                if (visited < edges[idx].size()) {
+                    stack.back().second++;
+                    const size_t from = edges[idx][visited].fromLayerIdx;
+                    if (from != invalidIdx && !used[from]) {
+                        used[from] = true;
+                        stack.emplace_back(from, 0);
+                    }
+                } else {
+                    order.push_back(idx);
+                    stack.pop_back();
+                }
+            }
         }
-        order.push_back(id);
-    };
-    std::for_each(outputs.begin(), outputs.end(), dfs);
+    }
 
     ngraph::ParameterVector parameter_nodes;
     ngraph::ResultVector result_nodes;
@@ -136,16 +276,20 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, std::i
     std::vector<std::shared_ptr<ngraph::op::Assign>> assign_nodes;
     std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
 
+    std::vector<std::shared_ptr<ngraph::Node>> id_to_node(params.size());
+    ConstantsCache constantsCache;
+
     //  Following topological order create nGraph operations
-    for (auto& layer_id : order) {
-        auto& p = params[layer_id];
-        ngraph::OutputVector inputs(edges[layer_id].size());
-        for (auto& e : edges[layer_id]) {
-            auto input_node = id_to_node[e.fromLayerId];
+    OV_ITT_SCOPED_TASK(itt::domains::V10Reader, "V10Parser::parse::nodes");
+    for (auto& layer_idx : order) {
+        auto& p = params[layer_idx];
+        ngraph::OutputVector inputs(edges[layer_idx].size());
+        for (auto& e : edges[layer_idx]) {
+            auto input_node = e.fromLayerIdx != invalidIdx ? id_to_node[e.fromLayerIdx] : nullptr;
             if (!input_node) {
                 THROW_IE_EXCEPTION << "Attempt to access node " << e.fromLayerId << " that not in graph.";
             }
-            auto& p_output = params[e.fromLayerId].params;
+            auto& p_output = params[e.fromLayerIdx].params;
             if (p.params.getRealInputPortId(e.toPortId) >= inputs.size())
                 THROW_IE_EXCEPTION << p.params.type << " layer " << p.params.name << " with id: " << p.params.layerId
                     << " is inconsistent!";
@@ -154,7 +298,18 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, std::i
         }
 
         auto node = createNode(inputs, p.xml, binStream, p.params);
-        id_to_node[layer_id] = node;
+
+        // Bitwise identical constants are merged into the first created one
+        if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(node)) {
+            if (!uniqueConstants.count(layer_idx)) {
+                auto cached = constantsCache.share(constant);
+                if (cached != constant) {
+                    id_to_node[layer_idx] = cached;
+                    continue;
+                }
+            }
+        }
+        id_to_node[layer_idx] = node;
 
         // Check that output shape after nGraph node validation the same as in IR
         // because IR always right!
@@ -283,7 +283,7 @@ std::vector<BatchNum> BlobCopy_BatchNum = {
 };
 
 std::vector<ChannelNum > BlobCopy_ChannelNum = {
-        3, 7,
+        3, 7, 35,
 };
 
 std::vector<Dims> BlobCopy_Dims = {
@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <cnn_network_impl.hpp>
 #include <details/ie_cnn_network_iterator.hpp>
 #include <string>
@@ -11,6 +12,7 @@
 #include <fstream>
 #include <memory>
 #include <map>
+#include <numeric>
 
 #include <cpp/ie_cnn_network.h>
 #include <ie_util_internal.hpp>
@@ -19,6 +21,7 @@
 #include <net_pass.h>
 
 #include <ngraph/opsets/opset3.hpp>
+#include <ngraph/binary_serializer.hpp>
 #include <ngraph/function.hpp>
 #include <ngraph/variant.hpp>
 #include <ngraph/op/maximum.hpp>
@@ -658,4 +661,59 @@ TEST(CNNNGraphImplTests, CanSetBatchReadValue) {
     EXPECT_EQ(status, StatusCode::OK);
 }
 
+// Writes about 9MB of files, run it with --gtest_also_run_disabled_tests
+TEST(CNNNGraphImplTests, DISABLED_CompareBinaryFunctionAndIRLoadTime) {
+    const size_t layers = 16, channels = 128;
+    std::shared_ptr<ngraph::Function> ngraph;
+    {
+        auto param = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32,
+                                                                 ngraph::Shape{1, channels, 16, 16});
+        ngraph::Output<ngraph::Node> value = param;
+        for (size_t i = 0; i < layers; i++) {
+            auto weights = std::make_shared<ngraph::opset3::Constant>(ngraph::element::f32,
+                    ngraph::Shape{channels, channels, 3, 3}, std::vector<float>(channels * channels * 9, 0.5f));
+            value = std::make_shared<ngraph::opset3::Convolution>(value, weights, ngraph::Strides{1, 1},
+                    ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1}, ngraph::Strides{1, 1});
+            value = std::make_shared<ngraph::opset3::Relu>(value);
+        }
+        auto result = std::make_shared<ngraph::op::Result>(value);
+        ngraph = std::make_shared<ngraph::Function>(ngraph::ResultVector{result},
+                                                    ngraph::ParameterVector{param});
+    }
+
+    const std::string prefix = "CompareBinaryFunctionAndIRLoadTime";
+    const std::string xmlPath = prefix + ".xml", binPath = prefix + ".bin", functionPath = prefix + ".ngraph";
+    CNNNetwork(ngraph).serialize(xmlPath, binPath);
+    ngraph::serialize_binary(functionPath, ngraph);
+
+    using clock = std::chrono::steady_clock;
+    Core ie;
+    auto start = clock::now();
+    auto irNetwork = ie.ReadNetwork(xmlPath, binPath);
+    auto irTime = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start).count();
+
+    start = clock::now();
+    CNNNetwork binaryNetwork(ngraph::deserialize_binary(functionPath));
+    // the weights are mapped lazily while the IR reader reads them, touch them to compare the same work
+    size_t checksum = 0;
+    for (const auto& op : binaryNetwork.getFunction()->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(op)) {
+            auto data = static_cast<const uint8_t*>(constant->get_data_ptr());
+            auto size = ngraph::shape_size(constant->get_shape()) * constant->get_element_type().size();
+            checksum = std::accumulate(data, data + size, checksum);
+        }
+    }
+    auto binaryTime = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start).count();
+
+    CommonTestUtils::removeIRFiles(xmlPath, binPath);
+    CommonTestUtils::removeFile(functionPath);
+
+    RecordProperty("IRLoadTimeUs", std::to_string(irTime));
+    RecordProperty("BinaryFunctionLoadTimeUs", std::to_string(binaryTime));
+    ASSERT_NE(0, checksum);
+    ASSERT_EQ(irNetwork.getInputsInfo().size(), binaryNetwork.getInputsInfo().size());
+    ASSERT_EQ(irNetwork.getOutputsInfo().size(), binaryNetwork.getOutputsInfo().size());
+    ASSERT_EQ(ngraph->get_ops().size(), binaryNetwork.getFunction()->get_ops().size());
+}
+
 IE_SUPPRESS_DEPRECATED_END
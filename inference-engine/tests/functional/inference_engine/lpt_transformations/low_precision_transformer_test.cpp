@@ -0,0 +1,181 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cnn_network_impl.hpp>
+#include <cpp/ie_cnn_network.h>
+#include <details/ie_cnn_network_tools.h>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "low_precision_transformations/blob_transformation.hpp"
+#include "low_precision_transformations/fake_quantize.hpp"
+#include "low_precision_transformations/network_helper.hpp"
+#include "low_precision_transformations/quantization_details.hpp"
+#include "low_precision_transformations/transformer.hpp"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+namespace {
+
+// Exposes the helpers the FakeQuantize transformation uses to fuse a per channel ScaleShift
+class FakeQuantizeTransformationHelper : public FakeQuantizeTransformation {
+public:
+    using FakeQuantizeTransformation::reshapeWeightsIntervalConst;
+    using FakeQuantizeTransformation::reshapeFakeQuantize;
+};
+
+std::shared_ptr<ngraph::Node> makeFakeQuantize(const ngraph::Output<ngraph::Node>& input, const float low, const float high) {
+    auto lowConst = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {low});
+    auto highConst = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {high});
+    return std::make_shared<ngraph::opset1::FakeQuantize>(input, lowConst, highConst, lowConst, highConst, 256);
+}
+
+std::shared_ptr<ngraph::Node> makeConvolution(const ngraph::Output<ngraph::Node>& input, const ngraph::Output<ngraph::Node>& weights) {
+    return std::make_shared<ngraph::opset1::Convolution>(input, weights, ngraph::Strides{1, 1},
+        ngraph::CoordinateDiff{0, 0}, ngraph::CoordinateDiff{0, 0}, ngraph::Strides{1, 1});
+}
+
+std::shared_ptr<ICNNNetwork> convertToLegacy(const std::shared_ptr<ngraph::Node>& output, const ngraph::ParameterVector& params) {
+    auto function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(output)}, params);
+    return std::make_shared<CNNNetworkImpl>(CNNNetwork(function));
+}
+
+size_t countLayers(const ICNNNetwork& network, const std::string& type) {
+    size_t count = 0;
+    for (const auto& layer : CNNNetSortTopologically(network)) {
+        if (layer->type == type) {
+            count++;
+        }
+    }
+    return count;
+}
+
+}  // namespace
+
+class LowPrecisionTransformerTests : public Test {};
+
+TEST_F(LowPrecisionTransformerTests, quantizationDetailsCacheIsInvalidatedByChangedConstants) {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 4, 2, 2});
+    auto fakeQuantize = makeFakeQuantize(input, 0.f, 2.55f);
+    fakeQuantize->set_friendly_name("fakeQuantize");
+    auto network = convertToLegacy(fakeQuantize, {input});
+
+    const CNNLayerPtr fakeQuantizeLayer = CNNNetworkHelper::getLayer(*network, "fakeQuantize");
+    ASSERT_NE(nullptr, fakeQuantizeLayer);
+
+    QuantizationDetailsCache cache;
+    const QuantizationDetails details = QuantizationDetails::getDetails(*fakeQuantizeLayer);
+    ASSERT_EQ(1ul, cache.entries.size());
+    const auto cached = cache.entries.begin()->second.details;
+    ASSERT_EQ(2.55f, details.getOutputHighValue(0));
+
+    // the same layer with the same constants is not recomputed
+    QuantizationDetails::getDetails(*fakeQuantizeLayer);
+    ASSERT_EQ(cached, cache.entries.begin()->second.details);
+
+    // updateBlobs installs a new blob to the output high constant
+    CNNNetworkHelper::updateBlobs(*fakeQuantizeLayer, 4, 1.f);
+    const QuantizationDetails updatedDetails = QuantizationDetails::getDetails(*fakeQuantizeLayer);
+    ASSERT_EQ(1ul, cache.entries.size());
+    ASSERT_NE(cached, cache.entries.begin()->second.details);
+    ASSERT_EQ(1.f, updatedDetails.getOutputHighValue(0));
+    ASSERT_EQ(2.55f, updatedDetails.getInputHighValue(0));
+    ASSERT_EQ(1ul, updatedDetails.inputIntervalsCount);
+
+    // per channel input intervals, as the fusion of a ScaleShift makes them
+    const std::vector<size_t> dims = {1, 4, 1, 1};
+    const std::vector<float> lows = {0.f, 0.1f, 0.2f, 0.3f};
+    const std::vector<float> highs = {1.f, 1.1f, 1.2f, 1.3f};
+    Blob::Ptr lowBlob = FakeQuantizeTransformationHelper::reshapeWeightsIntervalConst(
+        *CNNNetworkHelper::getParent(*fakeQuantizeLayer, 1), dims, Layout::NCHW);
+    CNNNetworkHelper::fillBlobByFP32(lowBlob, lows.data());
+    Blob::Ptr highBlob = FakeQuantizeTransformationHelper::reshapeWeightsIntervalConst(
+        *CNNNetworkHelper::getParent(*fakeQuantizeLayer, 2), dims, Layout::NCHW);
+    CNNNetworkHelper::fillBlobByFP32(highBlob, highs.data());
+    FakeQuantizeTransformationHelper::reshapeFakeQuantize(*fakeQuantizeLayer, dims, Layout::NCHW);
+
+    const QuantizationDetails reshapedDetails = QuantizationDetails::getDetails(*fakeQuantizeLayer);
+    ASSERT_EQ(1ul, cache.entries.size());
+    ASSERT_EQ(4ul, reshapedDetails.inputIntervalsCount);
+    for (size_t c = 0; c < dims[1]; ++c) {
+        ASSERT_EQ(lows[c], reshapedDetails.getInputLowValue(c));
+        ASSERT_EQ(highs[c], reshapedDetails.getInputHighValue(c));
+    }
+    ASSERT_EQ(1.f, reshapedDetails.getOutputHighValue(0));
+}
+
+TEST_F(LowPrecisionTransformerTests, blobTransformationWithWeightsSharedByLayers) {
+    const size_t outputChannels = 4, inputChannels = 3;
+    std::vector<float> weightsValues(outputChannels * inputChannels);
+    for (size_t i = 0; i < weightsValues.size(); ++i) {
+        // the values are on the quantization grid of the interval
+        weightsValues[i] = -1.f + 0.25f * i;
+    }
+
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, inputChannels, 4, 4});
+    auto weights = ngraph::opset1::Constant::create(
+        ngraph::element::f32, ngraph::Shape{outputChannels, inputChannels, 1, 1}, weightsValues);
+    auto weightsFakeQuantize = makeFakeQuantize(weights, -1.28f, 1.27f);
+    weightsFakeQuantize->set_friendly_name("weightsFakeQuantize");
+    auto convolution1 = makeConvolution(input, weightsFakeQuantize);
+    convolution1->set_friendly_name("convolution1");
+    auto convolution2 = makeConvolution(input, weightsFakeQuantize);
+    convolution2->set_friendly_name("convolution2");
+    auto add = std::make_shared<ngraph::opset1::Add>(convolution1, convolution2);
+    auto network = convertToLegacy(add, {input});
+    ASSERT_EQ(1ul, countLayers(*network, "FakeQuantize"));
+
+    BlobTransformation().transform(*network, true);
+
+    ASSERT_EQ(0ul, countLayers(*network, "FakeQuantize"));
+    ASSERT_EQ(0ul, countLayers(*network, "Const"));
+    for (const std::string name : {"convolution1", "convolution2"}) {
+        const CNNLayerPtr convolution = CNNNetworkHelper::getLayer(*network, name);
+        ASSERT_NE(nullptr, convolution) << name;
+        ASSERT_EQ(1ul, convolution->insData.size()) << name;
+
+        const auto it = convolution->blobs.find("weights");
+        ASSERT_NE(convolution->blobs.end(), it) << name;
+        ASSERT_EQ(weightsValues.size(), it->second->size()) << name;
+        const auto values = CNNNetworkHelper::getFloatData(it->second);
+        for (size_t i = 0; i < weightsValues.size(); ++i) {
+            ASSERT_NEAR(weightsValues[i], values.get()[i], 0.01f) << name << ": " << i;
+        }
+    }
+}
+
+TEST_F(LowPrecisionTransformerTests, statisticsAreCollected) {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 4, 4});
+    auto fakeQuantize = makeFakeQuantize(input, 0.f, 2.55f);
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{4, 3, 1, 1}, std::vector<float>(12, 0.5f));
+    auto convolution = makeConvolution(fakeQuantize, makeFakeQuantize(weights, -1.28f, 1.27f));
+    auto network = convertToLegacy(convolution, {input});
+
+    LowPrecisionTransformer transformer(LowPrecisionTransformer::getAllTransformations(LayerTransformation::Params()));
+    ASSERT_TRUE(transformer.getStatistics().empty());
+    transformer.transform(*network);
+
+    const auto& statistics = transformer.getStatistics();
+    ASSERT_FALSE(statistics.empty());
+    for (const auto& it : statistics) {
+        ASSERT_NE(std::string::npos, it.first.find(':')) << it.first;
+        ASSERT_LT(0ul, it.second.count) << it.first;
+        ASSERT_LE(0, it.second.time.count()) << it.first;
+    }
+
+    const auto fakeQuantizeIt = statistics.find("fakeQuantize:fakequantize");
+    ASSERT_NE(statistics.end(), fakeQuantizeIt);
+    ASSERT_EQ(2ul, fakeQuantizeIt->second.count);
+
+    const auto convolutionIt = statistics.find("transformation:convolution");
+    ASSERT_NE(statistics.end(), convolutionIt);
+    ASSERT_EQ(1ul, convolutionIt->second.count);
+}
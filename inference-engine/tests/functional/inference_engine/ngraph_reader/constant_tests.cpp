@@ -0,0 +1,700 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "ngraph_reader_tests.hpp"
+#include "low_precision_transformations/transformer.hpp"
+#include <ngraph/ngraph.hpp>
+
+TEST_F(NGraphReaderTests, ReadIdenticalConstantsAreMerged) {
+    std::string model = R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer id="0" name="in1" type="Parameter" version="opset1">
+            <data element_type="f32" shape="1,4"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="const_1" type="Const" version="opset1">
+            <data offset="0" size="16"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="max_1" type="Maximum" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="3" name="const_2" type="Const" version="opset1">
+            <data offset="16" size="16"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="4" name="max_2" type="Maximum" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="5" name="const_3" type="Const" version="opset1">
+            <data offset="32" size="16"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="6" name="max_3" type="Maximum" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="7" name="output" type="Result" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="4" to-port="0"/>
+        <edge from-layer="3" from-port="0" to-layer="4" to-port="1"/>
+        <edge from-layer="4" from-port="2" to-layer="6" to-port="0"/>
+        <edge from-layer="5" from-port="0" to-layer="6" to-port="1"/>
+        <edge from-layer="6" from-port="2" to-layer="7" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    Blob::Ptr weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {48}, Layout::C));
+    weights->allocate();
+    // const_1 and const_2 hold the same data, const_3 differs in the last element
+    float* data = weights->buffer().as<float*>();
+    const float values[] = {1.f, 2.f, 3.f, 4.f, 1.f, 2.f, 3.f, 4.f, 1.f, 2.f, 3.f, 5.f};
+    std::copy(std::begin(values), std::end(values), data);
+
+    Core reader;
+    auto network = reader.ReadNetwork(model, weights);
+    auto function = network.getFunction();
+    ASSERT_NE(nullptr, function);
+
+    std::vector<std::shared_ptr<ngraph::op::Constant>> constants;
+    for (const auto& op : function->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(op))
+            constants.push_back(constant);
+    }
+    ASSERT_EQ(2, constants.size());
+
+    std::shared_ptr<ngraph::Node> max_1, max_2, max_3;
+    for (const auto& op : function->get_ops()) {
+        if (op->get_friendly_name() == "max_1") max_1 = op;
+        if (op->get_friendly_name() == "max_2") max_2 = op;
+        if (op->get_friendly_name() == "max_3") max_3 = op;
+    }
+    ASSERT_NE(nullptr, max_1);
+    ASSERT_NE(nullptr, max_2);
+    ASSERT_NE(nullptr, max_3);
+    ASSERT_EQ(max_1->input_value(1).get_node_shared_ptr(), max_2->input_value(1).get_node_shared_ptr());
+    ASSERT_NE(max_1->input_value(1).get_node_shared_ptr(), max_3->input_value(1).get_node_shared_ptr());
+
+    IE_SUPPRESS_DEPRECATED_START
+    // convert to old representation
+    auto convertedNetwork = std::make_shared<details::CNNNetworkImpl>(network);
+    (void)convertedNetwork;
+    IE_SUPPRESS_DEPRECATED_END
+}
+
+TEST_F(NGraphReaderTests, ReadIdenticalWeightsAreMergedWithoutFakeQuantize) {
+    std::string model = R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer id="0" name="in1" type="Parameter" version="opset1">
+            <data element_type="f32" shape="1,4"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="const_1" type="Const" version="opset1">
+            <data offset="0" size="16"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="mul_1" type="Multiply" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="3" name="const_2" type="Const" version="opset1">
+            <data offset="16" size="16"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="4" name="mul_2" type="Multiply" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="5" name="const_3" type="Const" version="opset1">
+            <data offset="32" size="16"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="6" name="mul_3" type="Multiply" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="7" name="output" type="Result" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="4" to-port="0"/>
+        <edge from-layer="3" from-port="0" to-layer="4" to-port="1"/>
+        <edge from-layer="4" from-port="2" to-layer="6" to-port="0"/>
+        <edge from-layer="5" from-port="0" to-layer="6" to-port="1"/>
+        <edge from-layer="6" from-port="2" to-layer="7" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    Blob::Ptr weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {48}, Layout::C));
+    weights->allocate();
+    // const_1 and const_2 hold the same data, const_3 differs in the last element.
+    // The network has no FakeQuantize, so the low precision transformations do not modify the weights.
+    float* data = weights->buffer().as<float*>();
+    const float values[] = {1.f, 2.f, 3.f, 4.f, 1.f, 2.f, 3.f, 4.f, 1.f, 2.f, 3.f, 5.f};
+    std::copy(std::begin(values), std::end(values), data);
+
+    Core reader;
+    auto network = reader.ReadNetwork(model, weights);
+    auto function = network.getFunction();
+    ASSERT_NE(nullptr, function);
+
+    std::vector<std::shared_ptr<ngraph::op::Constant>> constants;
+    for (const auto& op : function->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(op))
+            constants.push_back(constant);
+    }
+    ASSERT_EQ(2, constants.size());
+
+    std::shared_ptr<ngraph::Node> mul_1, mul_2, mul_3;
+    for (const auto& op : function->get_ops()) {
+        if (op->get_friendly_name() == "mul_1") mul_1 = op;
+        if (op->get_friendly_name() == "mul_2") mul_2 = op;
+        if (op->get_friendly_name() == "mul_3") mul_3 = op;
+    }
+    ASSERT_NE(nullptr, mul_1);
+    ASSERT_NE(nullptr, mul_2);
+    ASSERT_NE(nullptr, mul_3);
+    ASSERT_EQ(mul_1->input_value(1).get_node_shared_ptr(), mul_2->input_value(1).get_node_shared_ptr());
+    ASSERT_NE(mul_1->input_value(1).get_node_shared_ptr(), mul_3->input_value(1).get_node_shared_ptr());
+
+    IE_SUPPRESS_DEPRECATED_START
+    // convert to old representation
+    auto convertedNetwork = std::make_shared<details::CNNNetworkImpl>(network);
+    (void)convertedNetwork;
+    IE_SUPPRESS_DEPRECATED_END
+}
+
+TEST_F(NGraphReaderTests, ReadIdenticalQuantizationConstantsAreNotMerged) {
+    std::string model = R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer id="0" name="in1" type="Parameter" version="opset1">
+            <data element_type="f32" shape="1,3,4,4"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="input_low_a" type="Const" version="opset1">
+            <data element_type="f32" offset="0" shape="1,1,1,1" size="4"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="input_high_a" type="Const" version="opset1">
+            <data element_type="f32" offset="4" shape="1,1,1,1" size="4"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="3" name="output_low_a" type="Const" version="opset1">
+            <data element_type="f32" offset="0" shape="1,1,1,1" size="4"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="4" name="output_high_a" type="Const" version="opset1">
+            <data element_type="f32" offset="4" shape="1,1,1,1" size="4"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="5" name="fq_a" type="FakeQuantize" version="opset1">
+            <data levels="256"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </input>
+            <output>
+                <port id="5" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="6" name="weights_a" type="Const" version="opset1">
+            <data element_type="f32" offset="8" shape="4,3,1,1" size="48"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>4</dim>
+                    <dim>3</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="7" name="conv_a" type="Convolution" version="opset1">
+            <data auto_pad="explicit" dilations="1,1" pads_begin="0,0" pads_end="0,0" strides="1,1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>4</dim>
+                    <dim>3</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="8" name="input_low_b" type="Const" version="opset1">
+            <data element_type="f32" offset="0" shape="1,1,1,1" size="4"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="9" name="input_high_b" type="Const" version="opset1">
+            <data element_type="f32" offset="4" shape="1,1,1,1" size="4"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="10" name="output_low_b" type="Const" version="opset1">
+            <data element_type="f32" offset="0" shape="1,1,1,1" size="4"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="11" name="output_high_b" type="Const" version="opset1">
+            <data element_type="f32" offset="4" shape="1,1,1,1" size="4"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="12" name="fq_b" type="FakeQuantize" version="opset1">
+            <data levels="256"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </input>
+            <output>
+                <port id="5" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="13" name="weights_b" type="Const" version="opset1">
+            <data element_type="f32" offset="8" shape="4,3,1,1" size="48"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>4</dim>
+                    <dim>3</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="14" name="conv_b" type="Convolution" version="opset1">
+            <data auto_pad="explicit" dilations="1,1" pads_begin="0,0" pads_end="0,0" strides="1,1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>4</dim>
+                    <dim>3</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="15" name="add" type="Add" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="16" name="output" type="Result" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="5" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="5" to-port="1"/>
+        <edge from-layer="2" from-port="0" to-layer="5" to-port="2"/>
+        <edge from-layer="3" from-port="0" to-layer="5" to-port="3"/>
+        <edge from-layer="4" from-port="0" to-layer="5" to-port="4"/>
+        <edge from-layer="5" from-port="5" to-layer="7" to-port="0"/>
+        <edge from-layer="6" from-port="0" to-layer="7" to-port="1"/>
+        <edge from-layer="0" from-port="0" to-layer="12" to-port="0"/>
+        <edge from-layer="8" from-port="0" to-layer="12" to-port="1"/>
+        <edge from-layer="9" from-port="0" to-layer="12" to-port="2"/>
+        <edge from-layer="10" from-port="0" to-layer="12" to-port="3"/>
+        <edge from-layer="11" from-port="0" to-layer="12" to-port="4"/>
+        <edge from-layer="12" from-port="5" to-layer="14" to-port="0"/>
+        <edge from-layer="13" from-port="0" to-layer="14" to-port="1"/>
+        <edge from-layer="7" from-port="2" to-layer="15" to-port="0"/>
+        <edge from-layer="14" from-port="2" to-layer="15" to-port="1"/>
+        <edge from-layer="15" from-port="2" to-layer="16" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    Blob::Ptr weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {56}, Layout::C));
+    weights->allocate();
+    // both FakeQuantize nodes read the same intervals, both convolutions read the same weights
+    float* data = weights->buffer().as<float*>();
+    data[0] = 0.f;
+    data[1] = 2.55f;
+    for (size_t i = 0; i < 12; i++)
+        data[2 + i] = i % 2 ? -0.5f : 1.f;
+
+    Core reader;
+    auto network = reader.ReadNetwork(model, weights);
+    auto function = network.getFunction();
+    ASSERT_NE(nullptr, function);
+
+    std::shared_ptr<ngraph::Node> fq_a, fq_b, conv_a, conv_b;
+    for (const auto& op : function->get_ops()) {
+        if (op->get_friendly_name() == "fq_a") fq_a = op;
+        if (op->get_friendly_name() == "fq_b") fq_b = op;
+        if (op->get_friendly_name() == "conv_a") conv_a = op;
+        if (op->get_friendly_name() == "conv_b") conv_b = op;
+    }
+    ASSERT_NE(nullptr, fq_a);
+    ASSERT_NE(nullptr, fq_b);
+    ASSERT_NE(nullptr, conv_a);
+    ASSERT_NE(nullptr, conv_b);
+    for (size_t i = 1; i < 5; i++)
+        ASSERT_NE(fq_a->input_value(i).get_node_shared_ptr(), fq_b->input_value(i).get_node_shared_ptr());
+    ASSERT_NE(conv_a->input_value(1).get_node_shared_ptr(), conv_b->input_value(1).get_node_shared_ptr());
+
+    IE_SUPPRESS_DEPRECATED_START
+    // the low precision transformations update the interval blobs of every FakeQuantize in place
+    auto convertedNetwork = std::make_shared<details::CNNNetworkImpl>(network);
+    details::LowPrecisionTransformer transformer(
+            details::LowPrecisionTransformer::getAllTransformations(details::LayerTransformation::Params()));
+    transformer.transform(*convertedNetwork);
+
+    std::vector<CNNLayerPtr> fakeQuantizes;
+    details::CNNNetworkIterator it(convertedNetwork.get()), end;
+    for (; it != end; ++it) {
+        if ((*it)->type == "FakeQuantize")
+            fakeQuantizes.push_back(*it);
+    }
+    ASSERT_EQ(2, fakeQuantizes.size());
+    for (size_t i = 1; i < 5; i++) {
+        auto constA = getCreatorLayer(fakeQuantizes[0]->insData[i].lock()).lock();
+        auto constB = getCreatorLayer(fakeQuantizes[1]->insData[i].lock()).lock();
+        ASSERT_NE(nullptr, constA);
+        ASSERT_NE(nullptr, constB);
+        ASSERT_NE(constA, constB);
+        ASSERT_EQ(1, getInputTo(constA->outData[0]).size());
+        ASSERT_EQ(1, getInputTo(constB->outData[0]).size());
+
+        // both branches are quantized the same way, so each interval is updated exactly once
+        auto blobA = constA->blobs["custom"];
+        auto blobB = constB->blobs["custom"];
+        ASSERT_NE(nullptr, blobA);
+        ASSERT_NE(nullptr, blobB);
+        ASSERT_EQ(blobA->byteSize(), blobB->byteSize());
+        ASSERT_EQ(0, std::memcmp(blobA->cbuffer().as<const uint8_t*>(), blobB->cbuffer().as<const uint8_t*>(),
+                                 blobA->byteSize()));
+    }
+    IE_SUPPRESS_DEPRECATED_END
+}
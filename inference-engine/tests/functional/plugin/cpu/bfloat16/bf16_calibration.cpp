@@ -0,0 +1,128 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "bfloat16_helpers.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <vector>
+#include <string>
+#include <map>
+
+#include <ie_core.hpp>
+#include <ngraph/variant.hpp>
+
+#include "functional_test_utils/blob_utils.hpp"
+#include "common_test_utils/common_utils.hpp"
+
+#include "ngraph/opsets/opset1.hpp"
+
+using namespace std;
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace LayerTestsDefinitions {
+
+namespace {
+
+std::shared_ptr<ngraph::Function> createConvConvGraph(const SizeVector &inputShapes) {
+    //     ScaleShift (FP32)
+    //          |
+    //        Conv
+    //          |
+    //        Conv
+    auto input1 = std::make_shared<opset1::Parameter>(ngraph::element::f32, ngraph::Shape{inputShapes});
+    auto const1 = opset1::Constant::create(ngraph::element::f32, Shape{1}, { 2.0f });
+    auto mulNode = std::make_shared<opset1::Multiply>(input1, const1);
+    auto const2 = opset1::Constant::create(ngraph::element::f32, Shape{1}, { 1.0f });
+    auto addNode = std::make_shared<opset1::Add>(mulNode, const2);
+    addNode->set_friendly_name("ADD_1");
+
+    auto channelsCount = inputShapes[1];
+    ngraph::Shape convFilterShape = { channelsCount, channelsCount, 3, 3 };
+    std::vector<float> weightValues(channelsCount * channelsCount * 3 * 3);
+    FuncTestUtils::fillInputsBySinValues(weightValues.data(), weightValues.size());
+
+    auto weightsNode1 = std::make_shared<ngraph::opset1::Constant>(ngraph::element::f32, convFilterShape, weightValues);
+    std::shared_ptr<ngraph::Node> convNode1 = std::make_shared<ngraph::opset1::Convolution>(
+        addNode, weightsNode1,
+        ngraph::Strides({ 1, 1 }),   // strides
+        ngraph::CoordinateDiff({ 1, 1 }),  // pad begin
+        ngraph::CoordinateDiff({ 1, 1 }),   // pad end
+        ngraph::Strides({ 1, 1 }),        // dilation
+        ngraph::op::PadType::EXPLICIT);   // pad type
+    convNode1->set_friendly_name("CONV_1");
+
+    auto weightsNode2 = std::make_shared<ngraph::opset1::Constant>(ngraph::element::f32, convFilterShape, weightValues);
+    std::shared_ptr<ngraph::Node> convNode2 = std::make_shared<ngraph::opset1::Convolution>(
+        convNode1, weightsNode2,
+        ngraph::Strides({ 1, 1 }),   // strides
+        ngraph::CoordinateDiff({ 0, 0 }),  // pad begin
+        ngraph::CoordinateDiff({ 0, 0 }),   // pad end
+        ngraph::Strides({ 1, 1 }),        // dilation
+        ngraph::op::PadType::EXPLICIT);   // pad type
+    convNode2->set_friendly_name("CONV_2");
+
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{convNode2}, ngraph::ParameterVector{input1});
+}
+
+std::map<std::string, std::string> getRuntimePrecisions(ExecutableNetwork &execNet) {
+    std::map<std::string, std::string> precisions;
+    auto function = execNet.GetExecGraphInfo().getFunction();
+    for (const auto &op : function->get_ops()) {
+        auto &rtInfo = op->get_rt_info();
+        auto it = rtInfo.find("runtimePrecision");
+        if (it == rtInfo.end())
+            continue;
+        auto variant = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+        if (variant)
+            precisions[op->get_friendly_name()] = variant->get();
+    }
+    return precisions;
+}
+
+std::map<std::string, std::string> loadCalibrated(const std::string &threshold) {
+    const SizeVector inputShapes = { 1, 3, 40, 40 };
+    const std::string samplesPath = "bf16_calibration_samples.bin";
+    {
+        // two samples of the only input
+        std::vector<float> samples(2 * 3 * 40 * 40);
+        FuncTestUtils::fillInputsBySinValues(samples.data(), samples.size());
+        std::ofstream file(samplesPath, std::ios::binary);
+        file.write(reinterpret_cast<const char *>(samples.data()), samples.size() * sizeof(float));
+    }
+
+    InferenceEngine::CNNNetwork cnnNet(createConvConvGraph(inputShapes));
+    auto ie = InferenceEngine::Core();
+    auto execNet = ie.LoadNetwork(cnnNet, CommonTestUtils::DEVICE_CPU, {
+        { PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES },
+        { PluginConfigParams::KEY_CPU_BF16_CALIBRATION_DATA, samplesPath },
+        { PluginConfigParams::KEY_CPU_BF16_CALIBRATION_THRESHOLD, threshold } });
+    std::remove(samplesPath.c_str());
+    return getRuntimePrecisions(execNet);
+}
+
+}  // namespace
+
+TEST(BF16Calibration, KeepsLayersInBF16WithinThreshold) {
+    if (!InferenceEngine::with_cpu_x86_bfloat16()) {
+        return;
+    }
+    auto precisions = loadCalibrated("10");
+    ASSERT_EQ(precisions["CONV_1"], "BF16");
+    ASSERT_EQ(precisions["CONV_2"], "BF16");
+}
+
+TEST(BF16Calibration, KeepsSensitiveLayersInFP32) {
+    if (!InferenceEngine::with_cpu_x86_bfloat16()) {
+        return;
+    }
+    // no bfloat16 layer is accurate enough for such a threshold
+    auto precisions = loadCalibrated("1e-7");
+    ASSERT_EQ(precisions["CONV_1"], "FP32");
+    ASSERT_EQ(precisions["CONV_2"], "FP32");
+}
+
+}  // namespace LayerTestsDefinitions
@@ -24,7 +24,14 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "8"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, InferenceEngine::PluginConfigParams::WEIGHTS_COMPRESSION_I8}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, InferenceEngine::PluginConfigParams::WEIGHTS_COMPRESSION_BF16}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_PROFILING_REPORT, ""}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_BF16_CALIBRATION_DATA, ""}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_BF16_CALIBRATION_THRESHOLD, "0.05"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_LATENCY_MODE, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_WEIGHTS_CACHE_DIR, ""}}
     };
 
     const std::vector<std::map<std::string, std::string>> MultiConfigs = {
@@ -59,7 +66,10 @@ namespace {
     const std::vector<std::map<std::string, std::string>> inconfigs = {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "OFF"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, "FP16"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_BF16_CALIBRATION_THRESHOLD, "-1"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_LATENCY_MODE, "ON"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
@@ -46,4 +46,24 @@ INSTANTIATE_TEST_CASE_P(
         GatherLayerTest::getTestCaseName
 );
 
+// Embedding-like lookups with scalar, SIMD-width and large slices
+const std::vector<std::vector<size_t>> lookupShapes = {
+        std::vector<size_t>{50},
+        std::vector<size_t>{50, 16},
+        std::vector<size_t>{50, 2048},
+};
+
+INSTANTIATE_TEST_CASE_P(
+        GatherLookup,
+        GatherLayerTest,
+        testing::Combine(
+                testing::Values(std::vector<int>{7, 49, 0, 7, 13, 31}),
+                testing::Values(std::vector<size_t>{2, 3}),
+                testing::Values(0),
+                testing::ValuesIn(lookupShapes),
+                testing::ValuesIn(netPrecisions),
+                testing::Values(CommonTestUtils::DEVICE_CPU)),
+        GatherLayerTest::getTestCaseName
+);
+
 }  // namespace
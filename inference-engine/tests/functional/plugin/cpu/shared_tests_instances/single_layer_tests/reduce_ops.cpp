@@ -22,6 +22,9 @@ const std::vector<std::vector<int>> axes = {
         {0},
         {0, 3},
         {1, -1},
+        {3},
+        {2, 3},
+        {1, 2},
 };
 const std::vector<ngraph::helpers::ReductionType> reductionTypes = {
         ngraph::helpers::ReductionType::Mean,
@@ -0,0 +1,133 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ie_plugin_config.hpp"
+#include "exec_graph_info.hpp"
+#include <ngraph/variant.hpp>
+
+using namespace InferenceEngine;
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,  // input shape
+        std::vector<size_t>,  // weights shape
+        std::string           // weights compression
+> fcCompressedLayerTestParamsSet;
+
+class FullyConnectedCompressedLayerCPUTest : public testing::WithParamInterface<fcCompressedLayerTestParamsSet>,
+                                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<fcCompressedLayerTestParamsSet> obj) {
+        std::vector<size_t> inputShape, weightsShape;
+        std::string compression;
+        std::tie(inputShape, weightsShape, compression) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "WS=" << CommonTestUtils::vec2str(weightsShape) << "_";
+        result << "compression=" << compression;
+        return result.str();
+    }
+
+protected:
+    std::string compression;
+
+    void SetUp() {
+        std::vector<size_t> inputShape, weightsShape;
+        std::tie(inputShape, weightsShape, compression) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        configuration.insert({PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, compression});
+        // the network is kept in FP32, only the weights are compressed
+        configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO});
+        // I8 weights lose up to a half of the quantization step of every output channel
+        threshold = compression == PluginConfigParams::WEIGHTS_COMPRESSION_I8 ? 5e-2f : 2e-2f;
+
+        auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+        auto paramOuts = ngraph::helpers::convert2OutputVector(
+                ngraph::helpers::castOps2Nodes<ngraph::op::Parameter>(params));
+        auto weights = ngraph::builder::makeConstant(ngPrc, weightsShape, {}, true);
+        auto matMul = ngraph::builder::makeMatMul(paramOuts[0], weights, false, false);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(matMul);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+        function = std::make_shared<ngraph::Function>(results, params, "FullyConnectedCompressed");
+    }
+
+    // The compressed weights path reports the weights precision in the implementation type, e.g. "jit_avx2_FP32_compressed_I8"
+    void CheckCompressedPath() {
+        IE_SUPPRESS_DEPRECATED_START
+        auto function = executableNetwork.GetExecGraphInfo().getFunction();
+        IE_SUPPRESS_DEPRECATED_END
+        ASSERT_NE(nullptr, function);
+
+        auto getExecValue = [](const std::shared_ptr<ngraph::Node>& node, const std::string& paramName) -> std::string {
+            const auto& rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(paramName);
+            IE_ASSERT(rtInfo.end() != it);
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            IE_ASSERT(nullptr != value);
+            return value->get();
+        };
+
+        const std::string suffix = std::string("_compressed_") +
+                (compression == PluginConfigParams::WEIGHTS_COMPRESSION_I8 ? "I8" : "BF16");
+        size_t fullyConnectedCount = 0;
+        for (const auto& node : function->get_ops()) {
+            if (getExecValue(node, ExecGraphInfoSerialization::LAYER_TYPE) != "FullyConnected")
+                continue;
+            fullyConnectedCount++;
+            const auto primType = getExecValue(node, ExecGraphInfoSerialization::IMPL_TYPE);
+            ASSERT_TRUE(primType.size() > suffix.size() &&
+                        primType.compare(primType.size() - suffix.size(), suffix.size(), suffix) == 0)
+                    << "FullyConnected is executed by " << primType << " instead of the compressed weights path";
+        }
+        ASSERT_EQ(1, fullyConnectedCount);
+    }
+};
+
+TEST_P(FullyConnectedCompressedLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckCompressedPath();
+}
+
+namespace {
+
+const std::vector<std::vector<size_t>> inputShapes = {
+        {1, 64},
+        {3, 64},
+        {5, 128}
+};
+
+const std::vector<std::vector<size_t>> weightsShapes = {
+        {64, 70},
+        {64, 128}
+};
+
+const std::vector<std::string> compressions = {
+        PluginConfigParams::WEIGHTS_COMPRESSION_I8,
+        PluginConfigParams::WEIGHTS_COMPRESSION_BF16
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_FullyConnectedCompressed_CPU, FullyConnectedCompressedLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Values(inputShapes[0], inputShapes[1]),
+                ::testing::Values(weightsShapes[0]),
+                ::testing::ValuesIn(compressions)),
+        FullyConnectedCompressedLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_FullyConnectedCompressedWide_CPU, FullyConnectedCompressedLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Values(inputShapes[2]),
+                ::testing::Values(weightsShapes[1]),
+                ::testing::ValuesIn(compressions)),
+        FullyConnectedCompressedLayerCPUTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
@@ -0,0 +1,218 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ie_plugin_config.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "exec_graph_info.hpp"
+#include <ngraph/variant.hpp>
+#include <ie_core.hpp>
+#include <cmath>
+
+using namespace InferenceEngine;
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        std::string,          // extension layer producing the output, "Gather" (planar) or "Interp" (blocked)
+        std::string,          // fused operation, "FakeQuantize", "ScaleShift", "PRelu" or "Relu"
+        std::vector<size_t>   // input shape
+> fusePostOpsTestParamsSet;
+
+class FusePostOpsCPUTest : public testing::WithParamInterface<fusePostOpsTestParamsSet>,
+                           virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<fusePostOpsTestParamsSet> obj) {
+        std::string layerType, postOpType;
+        std::vector<size_t> inputShape;
+        std::tie(layerType, postOpType, inputShape) = obj.param;
+
+        std::ostringstream result;
+        result << "Layer=" << layerType << "_";
+        result << "PostOp=" << postOpType << "_";
+        result << "IS=" << CommonTestUtils::vec2str(inputShape);
+        return result.str();
+    }
+
+    InferenceEngine::Blob::Ptr GenerateInput(const InferenceEngine::InputInfo &info) const override {
+        // negative values exercise the slopes of PRelu and Relu
+        return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), 20, -10, 4);
+    }
+
+protected:
+    std::string layerType, postOpType;
+    std::vector<float> scales, shifts, lows, highs;
+    // The same layer without the fused operation, the interpreter has no reference implementation of Interpolate
+    std::shared_ptr<ngraph::Function> layerFunction;
+
+    static std::shared_ptr<ngraph::Node> makeLayer(const std::string& layerType, const ngraph::Output<ngraph::Node>& in) {
+        const auto& inputShape = in.get_shape();
+        if (layerType == "Gather") {
+            auto indices = ngraph::opset1::Constant::create(ngraph::element::i32, ngraph::Shape{4}, {3, 0, 2, 5});
+            auto axis = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{}, {2});
+            return std::make_shared<ngraph::opset1::Gather>(in, indices, axis);
+        }
+
+        auto outShape = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{2},
+                {static_cast<int64_t>(inputShape[2] * 2), static_cast<int64_t>(inputShape[3] * 2)});
+        ngraph::op::InterpolateAttrs interpolateAttrs;
+        interpolateAttrs.align_corners = false;
+        interpolateAttrs.antialias = false;
+        interpolateAttrs.axes = ngraph::AxisSet{2, 3};
+        interpolateAttrs.mode = "linear";
+        interpolateAttrs.pads_begin = {0};
+        interpolateAttrs.pads_end = {0};
+        return std::make_shared<ngraph::opset1::Interpolate>(in, outShape, interpolateAttrs);
+    }
+
+    void SetUp() {
+        std::vector<size_t> inputShape;
+        std::tie(layerType, postOpType, inputShape) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        // FakeQuantize has to reach the plugin graph as is rather than be turned into INT8 execution
+        configuration.insert({PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE, PluginConfigParams::NO});
+        configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO});
+
+        auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+        auto paramOuts = ngraph::helpers::convert2OutputVector(
+                ngraph::helpers::castOps2Nodes<ngraph::op::Parameter>(params));
+        auto layer = makeLayer(layerType, paramOuts[0]);
+
+        // Every parameter differs per channel, so a wrong channel mapping of the fused operation changes the output
+        const size_t C = inputShape[1];
+        const ngraph::Shape perChannelShape{1, C, 1, 1};
+        scales.resize(C), shifts.resize(C), lows.resize(C), highs.resize(C);
+        for (size_t c = 0; c < C; c++) {
+            scales[c] = 0.5f + 0.25f * c;
+            shifts[c] = -1.f * c;
+            lows[c] = -5.f + 0.5f * c;
+            highs[c] = 2.f + 0.5f * c;
+        }
+
+        std::shared_ptr<ngraph::Node> postOp;
+        if (postOpType == "FakeQuantize") {
+            postOp = ngraph::builder::makeFakeQuantize(layer, ngPrc, 256, perChannelShape, lows, highs, lows, highs);
+            // the reference and the plugin may round a value on the quantization step boundary differently
+            threshold = (highs[C - 1] - lows[C - 1]) / 255.f + 1e-3f;
+        } else if (postOpType == "ScaleShift") {
+            auto multiply = std::make_shared<ngraph::opset1::Multiply>(layer,
+                    ngraph::opset1::Constant::create(ngPrc, perChannelShape, scales));
+            postOp = std::make_shared<ngraph::opset1::Add>(multiply,
+                    ngraph::opset1::Constant::create(ngPrc, perChannelShape, shifts));
+        } else if (postOpType == "PRelu") {
+            postOp = std::make_shared<ngraph::opset1::PRelu>(layer,
+                    ngraph::opset1::Constant::create(ngPrc, ngraph::Shape{C}, scales));
+        } else {
+            postOp = std::make_shared<ngraph::opset1::Relu>(layer);
+        }
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(postOp)};
+        function = std::make_shared<ngraph::Function>(results, params, "FusePostOps");
+
+        auto layerParams = ngraph::builder::makeParams(ngPrc, {inputShape});
+        ngraph::ResultVector layerResults{std::make_shared<ngraph::opset1::Result>(makeLayer(layerType, layerParams[0]))};
+        layerFunction = std::make_shared<ngraph::Function>(layerResults, layerParams, "FusePostOpsReference");
+    }
+
+    float applyPostOp(float value, size_t c) const {
+        if (postOpType == "FakeQuantize") {
+            if (value <= lows[c])
+                return lows[c];
+            if (value > highs[c])
+                return highs[c];
+            return std::round((value - lows[c]) / (highs[c] - lows[c]) * 255.f) / 255.f * (highs[c] - lows[c]) + lows[c];
+        } else if (postOpType == "ScaleShift") {
+            return value * scales[c] + shifts[c];
+        } else if (postOpType == "PRelu") {
+            return value < 0.f ? value * scales[c] : value;
+        }
+        return (std::max)(value, 0.f);
+    }
+
+    // Runs the layer alone and applies the operation to every channel of its planar output
+    std::vector<std::vector<std::uint8_t>> CalculateRefs() override {
+        InferenceEngine::Core ie;
+        auto layerNetwork = ie.LoadNetwork(InferenceEngine::CNNNetwork(layerFunction), targetDevice, configuration);
+        auto layerRequest = layerNetwork.CreateInferRequest();
+        layerRequest.SetBlob(layerNetwork.GetInputsInfo().begin()->first, inputs[0]);
+        layerRequest.Infer();
+
+        auto output = layerRequest.GetBlob(layerNetwork.GetOutputsInfo().begin()->first);
+        const auto& dims = output->getTensorDesc().getDims();
+        const size_t C = dims[1];
+        const size_t spatial = output->size() / (dims[0] * C);
+
+        std::vector<std::uint8_t> expected(output->byteSize());
+        auto src = output->cbuffer().as<const float*>();
+        auto dst = reinterpret_cast<float*>(expected.data());
+        for (size_t i = 0; i < output->size(); i++)
+            dst[i] = applyPostOp(src[i], (i / spatial) % C);
+        return {expected};
+    }
+
+    void CheckPostOpsFused() {
+        IE_SUPPRESS_DEPRECATED_START
+        auto function = executableNetwork.GetExecGraphInfo().getFunction();
+        IE_SUPPRESS_DEPRECATED_END
+        ASSERT_NE(nullptr, function);
+
+        auto getExecValue = [](const std::shared_ptr<ngraph::Node>& node, const std::string& paramName) -> std::string {
+            const auto& rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(paramName);
+            IE_ASSERT(rtInfo.end() != it);
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            IE_ASSERT(nullptr != value);
+            return value->get();
+        };
+
+        size_t layersFound = 0;
+        for (const auto& node : function->get_ops()) {
+            const auto type = getExecValue(node, ExecGraphInfoSerialization::LAYER_TYPE);
+            ASSERT_TRUE(type != "Quantize" && type != "Depthwise" && type != "Activation")
+                    << "The " << type << " node " << node->get_friendly_name() << " is not fused into " << layerType;
+            if (type == layerType)
+                layersFound++;
+        }
+        ASSERT_EQ(1, layersFound);
+    }
+};
+
+TEST_P(FusePostOpsCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckPostOpsFused();
+}
+
+namespace {
+
+const std::vector<std::string> postOpTypes = {
+        "FakeQuantize",
+        "ScaleShift",
+        "PRelu",
+        "Relu"
+};
+
+// C = 10 is not a multiple of the channel block, so the blocked output of Interp has padded channels.
+// Planar and blocked layouts are covered here, the channel-last mapping is covered by the PostOps unit tests.
+INSTANTIATE_TEST_CASE_P(smoke_FusePostOps_Gather, FusePostOpsCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values("Gather"),
+                                ::testing::ValuesIn(postOpTypes),
+                                ::testing::Values(std::vector<size_t>{2, 10, 6, 5})),
+                        FusePostOpsCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_FusePostOps_Interp, FusePostOpsCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values("Interp"),
+                                ::testing::ValuesIn(postOpTypes),
+                                ::testing::Values(std::vector<size_t>{2, 10, 6, 5})),
+                        FusePostOpsCPUTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace CPULayerTestsDefinitions
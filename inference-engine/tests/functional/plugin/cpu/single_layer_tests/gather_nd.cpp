@@ -0,0 +1,71 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ngraph/op/gather_nd.hpp>
+
+using namespace InferenceEngine;
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,  // data shape
+        std::vector<size_t>,  // indices shape
+        std::vector<int>      // indices
+> gatherNDLayerTestParamsSet;
+
+class GatherNDLayerCPUTest : public testing::WithParamInterface<gatherNDLayerTestParamsSet>,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<gatherNDLayerTestParamsSet> obj) {
+        std::vector<size_t> dataShape, indicesShape;
+        std::vector<int> indices;
+        std::tie(dataShape, indicesShape, indices) = obj.param;
+
+        std::ostringstream result;
+        result << "DS=" << CommonTestUtils::vec2str(dataShape) << "_";
+        result << "IS=" << CommonTestUtils::vec2str(indicesShape) << "_";
+        result << "indices=" << CommonTestUtils::vec2str(indices);
+        return result.str();
+    }
+
+protected:
+    void SetUp() {
+        std::vector<size_t> dataShape, indicesShape;
+        std::vector<int> indices;
+        std::tie(dataShape, indicesShape, indices) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {dataShape});
+        auto paramOuts = ngraph::helpers::convert2OutputVector(
+                ngraph::helpers::castOps2Nodes<ngraph::op::Parameter>(params));
+        auto indicesNode = std::make_shared<ngraph::opset1::Constant>(ngraph::element::i32, ngraph::Shape(indicesShape), indices);
+        auto gatherND = std::make_shared<ngraph::op::v0::GatherND>(paramOuts[0], indicesNode);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(gatherND)};
+        function = std::make_shared<ngraph::Function>(results, params, "GatherND");
+    }
+};
+
+TEST_P(GatherNDLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+// scalar, SIMD-width and large slices, negative indices count from the end of the dimension
+INSTANTIATE_TEST_CASE_P(smoke_GatherND_CPU, GatherNDLayerCPUTest,
+        ::testing::Values(
+                gatherNDLayerTestParamsSet{{5, 6}, {3, 2}, {0, 1, 4, -1, -5, 3}},
+                gatherNDLayerTestParamsSet{{10, 8}, {2, 2, 1}, {9, 0, -2, 3}},
+                gatherNDLayerTestParamsSet{{4, 3, 16}, {2, 2}, {1, 2, -1, 0}},
+                gatherNDLayerTestParamsSet{{3, 2048}, {2, 1}, {2, -3}},
+                gatherNDLayerTestParamsSet{{2, 3, 4, 5}, {3}, {1, 2, 3}}),
+        GatherNDLayerCPUTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
@@ -0,0 +1,139 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ie_plugin_config.hpp"
+#include <thread>
+
+using namespace InferenceEngine;
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        std::string,          // network type, "MLP" or "Conv"
+        std::vector<size_t>   // input shape
+> latencyModeTestParamsSet;
+
+class LatencyModeCPUTest : public testing::WithParamInterface<latencyModeTestParamsSet>,
+                           virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<latencyModeTestParamsSet> obj) {
+        std::string networkType;
+        std::vector<size_t> inputShape;
+        std::tie(networkType, inputShape) = obj.param;
+
+        std::ostringstream result;
+        result << "Net=" << networkType << "_";
+        result << "IS=" << CommonTestUtils::vec2str(inputShape);
+        return result.str();
+    }
+
+protected:
+    void SetUp() {
+        std::string networkType;
+        std::vector<size_t> inputShape;
+        std::tie(networkType, inputShape) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        configuration.insert({PluginConfigParams::KEY_CPU_LATENCY_MODE, PluginConfigParams::YES});
+        configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO});
+        // a single stream graph, so the second request gets a graph compiled for it
+        configuration.insert({PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "1"});
+
+        auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+        auto paramOuts = ngraph::helpers::convert2OutputVector(
+                ngraph::helpers::castOps2Nodes<ngraph::op::Parameter>(params));
+
+        std::shared_ptr<ngraph::Node> out;
+        if (networkType == "MLP") {
+            // the adjacent FullyConnected nodes are submitted together
+            auto weights1 = ngraph::builder::makeConstant(ngPrc, {inputShape[1], 32}, {}, true);
+            auto matMul1 = ngraph::builder::makeMatMul(paramOuts[0], weights1, false, false);
+            auto relu = std::make_shared<ngraph::opset1::Relu>(matMul1);
+            auto weights2 = ngraph::builder::makeConstant(ngPrc, {32, 10}, {}, true);
+            auto matMul2 = ngraph::builder::makeMatMul(relu, weights2, false, false);
+            out = std::make_shared<ngraph::opset1::Softmax>(matMul2, 1);
+        } else {
+            // the convolutions and the pooling between them are submitted together
+            auto conv1 = ngraph::builder::makeConvolution(paramOuts[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                          ngraph::op::PadType::EXPLICIT, 16);
+            auto relu = std::make_shared<ngraph::opset1::Relu>(conv1);
+            auto pool = ngraph::builder::makePooling(relu, {2, 2}, {0, 0}, {0, 0}, {2, 2}, ngraph::op::RoundingType::FLOOR,
+                                                     ngraph::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+            out = ngraph::builder::makeConvolution(pool, ngPrc, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                   ngraph::op::PadType::EXPLICIT, 8);
+        }
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(out)};
+        function = std::make_shared<ngraph::Function>(results, params, "LatencyMode");
+    }
+
+    unsigned int compiledGraphs() const {
+        return executableNetwork.GetMetric(METRIC_KEY(CPU_COMPILED_GRAPHS)).as<unsigned int>();
+    }
+
+    std::vector<std::uint8_t> getOutput(InferRequest& request) const {
+        auto output = request.GetBlob(executableNetwork.GetOutputsInfo().begin()->first);
+        auto data = output->cbuffer().as<const std::uint8_t*>();
+        return std::vector<std::uint8_t>(data, data + output->byteSize());
+    }
+
+    std::vector<std::uint8_t> inferOnNewThread(InferRequest& request) const {
+        std::thread([&] {
+            request.SetBlob(executableNetwork.GetInputsInfo().begin()->first, inputs[0]);
+            ASSERT_NO_THROW(request.Infer());
+        }).join();
+        return getOutput(request);
+    }
+
+    // Every request infers with the graph bound to it, whatever thread calls Infer
+    void CheckBoundGraphs() {
+        ASSERT_LT(0u, executableNetwork.GetMetric(METRIC_KEY(CPU_LATENCY_PLAN_STEPS)).as<unsigned int>());
+        const auto graphs = compiledGraphs();
+        ASSERT_EQ(1u, graphs);
+
+        const auto expected = getOutput(inferRequest);
+
+        ASSERT_EQ(expected, inferOnNewThread(inferRequest));
+        ASSERT_EQ(graphs, compiledGraphs());
+
+        {
+            auto request = executableNetwork.CreateInferRequest();
+            ASSERT_EQ(graphs + 1, compiledGraphs());
+            ASSERT_EQ(expected, inferOnNewThread(request));
+            ASSERT_EQ(graphs + 1, compiledGraphs());
+        }
+
+        // the graph of the destroyed request is bound to the next one
+        auto request = executableNetwork.CreateInferRequest();
+        ASSERT_EQ(expected, inferOnNewThread(request));
+        ASSERT_EQ(graphs + 1, compiledGraphs());
+    }
+};
+
+TEST_P(LatencyModeCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckBoundGraphs();
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_LatencyMode_MLP, LatencyModeCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values("MLP"),
+                                ::testing::Values(std::vector<size_t>{1, 40})),
+                        LatencyModeCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_LatencyMode_Conv, LatencyModeCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values("Conv"),
+                                ::testing::Values(std::vector<size_t>{1, 3, 16, 16})),
+                        LatencyModeCPUTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace CPULayerTestsDefinitions
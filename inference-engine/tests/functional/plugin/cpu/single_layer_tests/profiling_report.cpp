@@ -0,0 +1,120 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef _WIN32
+
+#include <gtest/gtest.h>
+
+#include "functional_test_utils/blob_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ie_plugin_config.hpp"
+#include <ie_core.hpp>
+
+#include <dirent.h>
+#include <unistd.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace CPULayerTestsDefinitions {
+
+class ProfilingReportCPUTest : public ::testing::Test {
+protected:
+    std::string reportDir;
+    std::shared_ptr<ngraph::Function> function;
+
+    void SetUp() override {
+        char dirTemplate[] = "/tmp/ie_cpu_profiling_report_XXXXXX";
+        ASSERT_NE(nullptr, mkdtemp(dirTemplate));
+        reportDir = dirTemplate;
+
+        auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {{1, 3, 16, 16}});
+        auto conv = ngraph::builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, 16);
+        conv->set_friendly_name("conv");
+        auto pool = ngraph::builder::makePooling(conv, {2, 2}, {0, 0}, {0, 0}, {2, 2}, ngraph::op::RoundingType::FLOOR,
+                                                 ngraph::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(pool)};
+        // the path separator in the name must not end up in the path of the report
+        function = std::make_shared<ngraph::Function>(results, params, "profiling/report");
+    }
+
+    void TearDown() override {
+        for (const auto& file : reportFiles())
+            std::remove((reportDir + "/" + file).c_str());
+        rmdir(reportDir.c_str());
+    }
+
+    std::vector<std::string> reportFiles() const {
+        std::vector<std::string> files;
+        DIR* dir = opendir(reportDir.c_str());
+        if (dir == nullptr)
+            return files;
+        while (auto entry = readdir(dir)) {
+            const std::string name = entry->d_name;
+            if (name != "." && name != "..")
+                files.push_back(name);
+        }
+        closedir(dir);
+        return files;
+    }
+
+    static std::string readFile(const std::string& path) {
+        std::ifstream file(path);
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    static bool endsWith(const std::string& str, const std::string& suffix) {
+        return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+};
+
+TEST_F(ProfilingReportCPUTest, GetPerformanceCountsWritesReport) {
+    const size_t inferCount = 3;
+    const std::string prefix = reportDir + "/report";
+
+    Core ie;
+    auto network = ie.LoadNetwork(CNNNetwork(function), CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_PROFILING_REPORT, prefix},
+                                   {PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "1"}});
+    auto request = network.CreateInferRequest();
+    request.SetBlob(network.GetInputsInfo().begin()->first, FuncTestUtils::createAndFillBlob(
+            TensorDesc(Precision::FP32, {1, 3, 16, 16}, Layout::NCHW)));
+    for (size_t i = 0; i < inferCount; i++)
+        request.Infer();
+
+    ASSERT_TRUE(reportFiles().empty());
+    auto perfCounts = request.GetPerformanceCounts();
+    ASSERT_NE(perfCounts.end(), perfCounts.find("conv"));
+
+    // one graph, so exactly one trace and one roofline report, both in the directory of the prefix
+    std::string trace, roofline;
+    const auto files = reportFiles();
+    ASSERT_EQ(2, files.size());
+    for (const auto& file : files) {
+        ASSERT_EQ(0, file.find("report_profiling_report_")) << file;
+        if (endsWith(file, "_trace.json"))
+            trace = readFile(reportDir + "/" + file);
+        else if (endsWith(file, "_roofline.json"))
+            roofline = readFile(reportDir + "/" + file);
+    }
+
+    ASSERT_EQ(0, trace.find("{\"traceEvents\":["));
+    ASSERT_NE(std::string::npos, trace.find("{\"name\":\"conv\""));
+    ASSERT_EQ(0, roofline.find("{\"timestamps_per_us\":"));
+    const auto conv = roofline.find("{\"name\":\"conv\"");
+    ASSERT_NE(std::string::npos, conv);
+    ASSERT_NE(std::string::npos, roofline.find("\"count\":" + std::to_string(inferCount), conv));
+}
+
+}  // namespace CPULayerTestsDefinitions
+
+#endif  // _WIN32
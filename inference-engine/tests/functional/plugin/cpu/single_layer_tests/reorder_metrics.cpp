@@ -0,0 +1,75 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "functional_test_utils/blob_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ie_plugin_config.hpp"
+#include <ie_core.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace CPULayerTestsDefinitions {
+
+class ReorderMetricsCPUTest : public ::testing::Test {
+protected:
+    const std::vector<size_t> inputShape = {1, 3, 16, 16};
+
+    ExecutableNetwork loadNetwork(const std::shared_ptr<ngraph::Node>& out,
+                                  const std::vector<std::shared_ptr<ngraph::opset1::Parameter>>& params) {
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(out)};
+        auto function = std::make_shared<ngraph::Function>(results, params, "ReorderMetrics");
+        return ie.LoadNetwork(CNNNetwork(function), CommonTestUtils::DEVICE_CPU,
+                              {{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO},
+                               {PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "1"}});
+    }
+
+    void infer(ExecutableNetwork& network) {
+        auto request = network.CreateInferRequest();
+        request.SetBlob(network.GetInputsInfo().begin()->first, FuncTestUtils::createAndFillBlob(
+                TensorDesc(Precision::FP32, inputShape, Layout::NCHW)));
+        request.Infer();
+    }
+
+    Core ie;
+};
+
+TEST_F(ReorderMetricsCPUTest, PlanarNetworkHasNoReorders) {
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+    auto network = loadNetwork(std::make_shared<ngraph::opset1::Relu>(params[0]), params);
+
+    ASSERT_EQ(0, network.GetMetric(METRIC_KEY(CPU_REORDERED_BYTES)).as<uint64_t>());
+}
+
+TEST_F(ReorderMetricsCPUTest, MetricsDescribeCompiledGraph) {
+    auto ngPrc = ngraph::element::f32;
+    auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+    auto conv = ngraph::builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                 ngraph::op::PadType::EXPLICIT, 16);
+    auto pool = ngraph::builder::makePooling(conv, {2, 2}, {0, 0}, {0, 0}, {2, 2}, ngraph::op::RoundingType::FLOOR,
+                                             ngraph::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+    auto network = loadNetwork(pool, params);
+
+    const auto metrics = network.GetMetric(METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
+    for (const auto& metric : {METRIC_KEY(CPU_ELIMINATED_REORDERS), METRIC_KEY(CPU_REORDERED_BYTES)})
+        ASSERT_NE(metrics.end(), std::find(metrics.begin(), metrics.end(), metric)) << metric;
+
+    const auto eliminated = network.GetMetric(METRIC_KEY(CPU_ELIMINATED_REORDERS)).as<unsigned int>();
+    const auto bytes = network.GetMetric(METRIC_KEY(CPU_REORDERED_BYTES)).as<uint64_t>();
+    // all the reordered tensors are FP32
+    ASSERT_EQ(0, bytes % sizeof(float));
+
+    // the metrics describe the compiled graph, an inference does not change them
+    infer(network);
+    ASSERT_EQ(eliminated, network.GetMetric(METRIC_KEY(CPU_ELIMINATED_REORDERS)).as<unsigned int>());
+    ASSERT_EQ(bytes, network.GetMetric(METRIC_KEY(CPU_REORDERED_BYTES)).as<uint64_t>());
+}
+
+}  // namespace CPULayerTestsDefinitions
@@ -0,0 +1,98 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,                // input shape
+        int64_t,                            // axis
+        int64_t,                            // k
+        ngraph::opset1::TopK::Mode,         // mode
+        ngraph::opset1::TopK::SortType      // sort
+> topKLayerTestParamsSet;
+
+class TopKLayerCPUTest : public testing::WithParamInterface<topKLayerTestParamsSet>,
+                         virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<topKLayerTestParamsSet> obj) {
+        std::vector<size_t> inputShape;
+        int64_t axis, k;
+        ngraph::opset1::TopK::Mode mode;
+        ngraph::opset1::TopK::SortType sort;
+        std::tie(inputShape, axis, k, mode, sort) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "axis=" << axis << "_";
+        result << "k=" << k << "_";
+        result << "mode=" << (mode == ngraph::opset1::TopK::Mode::MAX ? "max" : "min") << "_";
+        result << "sort=" << (sort == ngraph::opset1::TopK::SortType::SORT_VALUES ? "value" : "index");
+        return result.str();
+    }
+
+protected:
+    void SetUp() {
+        std::vector<size_t> inputShape;
+        int64_t axis, k;
+        ngraph::opset1::TopK::Mode mode;
+        ngraph::opset1::TopK::SortType sort;
+        std::tie(inputShape, axis, k, mode, sort) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        auto paramOuts = ngraph::helpers::convert2OutputVector(
+                ngraph::helpers::castOps2Nodes<ngraph::op::Parameter>(params));
+        auto kNode = std::make_shared<ngraph::opset1::Constant>(ngraph::element::i64, ngraph::Shape{}, std::vector<int64_t>{k});
+        auto topK = std::make_shared<ngraph::opset1::TopK>(paramOuts[0], kNode, axis, mode, sort);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(topK->output(0)),
+                                     std::make_shared<ngraph::opset1::Result>(topK->output(1))};
+        function = std::make_shared<ngraph::Function>(results, params, "TopK");
+    }
+};
+
+TEST_P(TopKLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const std::vector<ngraph::opset1::TopK::Mode> modes = {
+        ngraph::opset1::TopK::Mode::MAX,
+        ngraph::opset1::TopK::Mode::MIN
+};
+
+const std::vector<ngraph::opset1::TopK::SortType> sortTypes = {
+        ngraph::opset1::TopK::SortType::SORT_VALUES,
+        ngraph::opset1::TopK::SortType::SORT_INDICES
+};
+
+// large K over a vocabulary-sized axis: heap selection, a single row is split between threads
+INSTANTIATE_TEST_CASE_P(smoke_TopK_LargeK_CPU, TopKLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Values(std::vector<size_t>{1, 30000}, std::vector<size_t>{4, 5000}),
+                ::testing::Values(1),
+                ::testing::Values(1, 200),
+                ::testing::ValuesIn(modes),
+                ::testing::ValuesIn(sortTypes)),
+        TopKLayerCPUTest::getTestCaseName);
+
+// K comparable with the axis length: partial sort, and an inner axis with strided rows
+INSTANTIATE_TEST_CASE_P(smoke_TopK_PartialSort_CPU, TopKLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Values(std::vector<size_t>{2, 64, 3}),
+                ::testing::Values(1),
+                ::testing::Values(40, 64),
+                ::testing::ValuesIn(modes),
+                ::testing::ValuesIn(sortTypes)),
+        TopKLayerCPUTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
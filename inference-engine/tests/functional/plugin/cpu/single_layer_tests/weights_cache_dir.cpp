@@ -0,0 +1,142 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef _WIN32
+
+#include <gtest/gtest.h>
+
+#include "functional_test_utils/blob_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ie_plugin_config.hpp"
+#include <ie_core.hpp>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
+#include <map>
+
+using namespace InferenceEngine;
+
+namespace CPULayerTestsDefinitions {
+
+class WeightsCacheDirCPUTest : public ::testing::Test {
+protected:
+    std::string cacheDir;
+    std::shared_ptr<ngraph::Function> function;
+    Blob::Ptr input;
+
+    void SetUp() override {
+        char dirTemplate[] = "/tmp/ie_cpu_weights_cache_XXXXXX";
+        ASSERT_NE(nullptr, mkdtemp(dirTemplate));
+        cacheDir = dirTemplate;
+
+        auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {{1, 3, 16, 16}});
+        // the weights of both convolutions are reordered to the layouts of their implementations
+        auto conv1 = ngraph::builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ngraph::op::PadType::EXPLICIT, 16);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(conv1);
+        auto conv2 = ngraph::builder::makeConvolution(relu, ngPrc, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                      ngraph::op::PadType::EXPLICIT, 16);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(conv2)};
+        function = std::make_shared<ngraph::Function>(results, params, "WeightsCacheDir");
+
+        input = FuncTestUtils::createAndFillBlob(TensorDesc(Precision::FP32, {1, 3, 16, 16}, Layout::NCHW));
+    }
+
+    void TearDown() override {
+        for (const auto& file : cacheFiles())
+            std::remove(file.first.c_str());
+        rmdir(cacheDir.c_str());
+    }
+
+    // Paths of the files in the cache directory and their inodes, a rewritten file gets a new inode
+    std::map<std::string, ino_t> cacheFiles() const {
+        std::map<std::string, ino_t> files;
+        DIR* dir = opendir(cacheDir.c_str());
+        if (dir == nullptr)
+            return files;
+        while (auto entry = readdir(dir)) {
+            const std::string name = entry->d_name;
+            if (name == "." || name == "..")
+                continue;
+            const std::string path = cacheDir + "/" + name;
+            struct stat st;
+            if (stat(path.c_str(), &st) == 0)
+                files[path] = st.st_ino;
+        }
+        closedir(dir);
+        return files;
+    }
+
+    // Loads the network to a plugin of its own, so the weights can only come from the directory.
+    // A single stream, as in the one process per socket setup, still stores and maps the weights.
+    std::vector<float> loadAndInfer() const {
+        Core ie;
+        auto network = ie.LoadNetwork(CNNNetwork(function), CommonTestUtils::DEVICE_CPU,
+                                      {{PluginConfigParams::KEY_CPU_WEIGHTS_CACHE_DIR, cacheDir},
+                                       {PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "1"}});
+        auto request = network.CreateInferRequest();
+        request.SetBlob(network.GetInputsInfo().begin()->first, input);
+        request.Infer();
+
+        auto output = request.GetBlob(network.GetOutputsInfo().begin()->first);
+        auto data = output->cbuffer().as<const float*>();
+        return std::vector<float>(data, data + output->size());
+    }
+};
+
+TEST_F(WeightsCacheDirCPUTest, SecondLoadNetworkMapsStoredWeights) {
+    const auto expected = loadAndInfer();
+
+    const auto stored = cacheFiles();
+    ASSERT_FALSE(stored.empty());
+    for (const auto& file : stored) {
+        ASSERT_NE(std::string::npos, file.first.find(".blob")) << file.first;
+        // the header with the magic and the version precedes the page aligned payload
+        char magic[8] = {};
+        FILE* f = std::fopen(file.first.c_str(), "rb");
+        ASSERT_NE(nullptr, f);
+        ASSERT_EQ(sizeof(magic), std::fread(magic, 1, sizeof(magic), f));
+        std::fclose(f);
+        ASSERT_EQ(0, std::memcmp(magic, "IECPUWC", 8));
+        ASSERT_GT(CommonTestUtils::fileSize(file.first), 4096);
+    }
+
+    ASSERT_EQ(expected, loadAndInfer());
+    // the files are mapped rather than written again
+    ASSERT_EQ(stored, cacheFiles());
+}
+
+TEST_F(WeightsCacheDirCPUTest, CorruptedWeightsAreNotMapped) {
+    const auto expected = loadAndInfer();
+
+    const auto stored = cacheFiles();
+    ASSERT_FALSE(stored.empty());
+    const auto& corrupted = stored.begin()->first;
+    {
+        int fd = open(corrupted.c_str(), O_RDWR);
+        ASSERT_GE(fd, 0);
+        unsigned char value = 0;
+        ASSERT_EQ(1, pread(fd, &value, 1, 4096));
+        value ^= 0xff;
+        ASSERT_EQ(1, pwrite(fd, &value, 1, 4096));
+        close(fd);
+    }
+
+    // the payload CRC doesn't match, so the weights are prepared and stored again
+    ASSERT_EQ(expected, loadAndInfer());
+    const auto rewritten = cacheFiles();
+    ASSERT_EQ(stored.size(), rewritten.size());
+    ASSERT_NE(stored.at(corrupted), rewritten.at(corrupted));
+}
+
+}  // namespace CPULayerTestsDefinitions
+
+#endif  // _WIN32
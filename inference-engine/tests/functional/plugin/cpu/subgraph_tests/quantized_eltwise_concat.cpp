@@ -0,0 +1,84 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+
+#include "subgraph_tests/quantized_eltwise_concat.hpp"
+#include "exec_graph_info.hpp"
+#include <ngraph/variant.hpp>
+
+using namespace LayerTestsDefinitions;
+
+namespace CPUSubgraphTestsDefinitions {
+
+class QuantEltwiseConcatCPUTest : public QuantEltwiseConcatTest {
+protected:
+    // The dequantization of the INT8 inputs is done by the Eltwise kernel or after the Concat,
+    // so both of them read the output of the input FakeQuantize as is
+    void CheckInt8Inputs() {
+        IE_SUPPRESS_DEPRECATED_START
+        auto function = executableNetwork.GetExecGraphInfo().getFunction();
+        IE_SUPPRESS_DEPRECATED_END
+        ASSERT_NE(nullptr, function);
+
+        auto getExecValue = [](const std::shared_ptr<ngraph::Node>& node, const std::string& paramName) -> std::string {
+            const auto& rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(paramName);
+            IE_ASSERT(rtInfo.end() != it);
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            IE_ASSERT(nullptr != value);
+            return value->get();
+        };
+
+        size_t nodesFound = 0;
+        for (const auto& node : function->get_ops()) {
+            const auto type = getExecValue(node, ExecGraphInfoSerialization::LAYER_TYPE);
+            if (type != "Eltwise" && type != "Concatenation")
+                continue;
+
+            nodesFound++;
+            ASSERT_EQ(2, node->get_input_size());
+            for (size_t i = 0; i < node->get_input_size(); i++) {
+                const auto parent = node->get_input_node_shared_ptr(i);
+                ASSERT_NE("Depthwise", getExecValue(parent, ExecGraphInfoSerialization::LAYER_TYPE))
+                        << "The input " << i << " of " << node->get_friendly_name() << " is dequantized by "
+                        << parent->get_friendly_name();
+
+                const auto precision = node->get_input_element_type(i);
+                ASSERT_TRUE(precision == ngraph::element::u8 || precision == ngraph::element::i8)
+                        << "The input " << i << " of " << node->get_friendly_name() << " is " << precision;
+            }
+        }
+        ASSERT_EQ(1, nodesFound);
+    }
+};
+
+TEST_P(QuantEltwiseConcatCPUTest, CompareWithRefs) {
+    Run();
+    CheckInt8Inputs();
+}
+
+namespace {
+
+const std::vector<std::string> opTypes = {
+        "Add",
+        "Multiply",
+        "Concat"
+};
+
+const std::vector<std::vector<size_t>> inputShapes = {
+        {1, 16, 4, 4},
+        {1, 32, 3, 5}
+};
+
+INSTANTIATE_TEST_CASE_P(QuantEltwiseConcat, QuantEltwiseConcatCPUTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(opTypes),
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        QuantEltwiseConcatTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace CPUSubgraphTestsDefinitions
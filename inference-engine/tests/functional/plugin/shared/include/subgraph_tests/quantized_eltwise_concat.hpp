@@ -0,0 +1,31 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+
+typedef std::tuple<
+        std::string,                    // "Add", "Multiply" or "Concat"
+        InferenceEngine::SizeVector,
+        LayerTestsUtils::TargetDevice> QuantEltwiseConcatParamsSet;
+
+namespace LayerTestsDefinitions {
+
+// Two differently quantized inputs combined by an elementwise operation or a concatenation
+class QuantEltwiseConcatTest : public testing::WithParamInterface<QuantEltwiseConcatParamsSet>,
+                               virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<QuantEltwiseConcatParamsSet> &obj);
+
+protected:
+    void SetUp() override;
+};
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,69 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "subgraph_tests/quantized_eltwise_concat.hpp"
+#include "ngraph_functions/builders.hpp"
+
+namespace LayerTestsDefinitions {
+
+std::string QuantEltwiseConcatTest::getTestCaseName(const testing::TestParamInfo<QuantEltwiseConcatParamsSet> &obj) {
+    std::string opType;
+    InferenceEngine::SizeVector inputShape;
+    std::string targetDevice;
+    std::tie(opType, inputShape, targetDevice) = obj.param;
+
+    std::ostringstream result;
+    result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+    result << "Op=" << opType << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+void QuantEltwiseConcatTest::SetUp() {
+    std::string opType;
+    InferenceEngine::SizeVector inputShape;
+    std::tie(opType, inputShape, targetDevice) = this->GetParam();
+
+    auto ngPrc = ngraph::element::f32;
+    auto params = ngraph::builder::makeParams(ngPrc, {inputShape, inputShape});
+    auto paramOuts = ngraph::helpers::convert2OutputVector(
+            ngraph::helpers::castOps2Nodes<ngraph::op::Parameter>(params));
+
+    auto makeFakeQuantizeNode = [ngPrc, &inputShape](const ngraph::Output<ngraph::Node> &in, float high) {
+        std::vector<size_t> constShapes(inputShape.size(), 1);
+        return ngraph::builder::makeFakeQuantize(in, ngPrc, 256, constShapes, {0.f}, {high}, {0.f}, {high});
+    };
+
+    // The quantization steps of the inputs (0.02 and 0.1) differ, so that each input is dequantized
+    // with its own scale. The steps are chosen so that no value lands on a rounding tie of the output FQ.
+    auto fq0 = makeFakeQuantizeNode(paramOuts[0], 5.1f);
+    auto fq1 = makeFakeQuantizeNode(paramOuts[1], 25.5f);
+
+    std::shared_ptr<ngraph::Node> op;
+    if (opType == "Add") {
+        op = std::make_shared<ngraph::opset1::Add>(fq0, fq1);
+    } else if (opType == "Multiply") {
+        op = std::make_shared<ngraph::opset1::Multiply>(fq0, fq1);
+    } else if (opType == "Concat") {
+        auto concat = std::make_shared<ngraph::opset1::Concat>(ngraph::OutputVector{fq0, fq1}, 1);
+        op = makeFakeQuantizeNode(concat, 25.5f);
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported operation type " << opType;
+    }
+
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(op)};
+    function = std::make_shared<ngraph::Function>(results, params, "QuantEltwiseConcat");
+}
+
+TEST_P(QuantEltwiseConcatTest, CompareWithRefs) {
+    Run();
+};
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,105 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "nodes/common/post_ops.hpp"
+
+using namespace InferenceEngine;
+using PostOps = InferenceEngine::Extensions::Cpu::PostOps;
+
+namespace {
+
+// Replaces every value with the index of its channel
+void appendChannelIndex(PostOps& postOps) {
+    postOps.append([](float* data, size_t count, const PostOps::Channels& channels) {
+        PostOps::forEach(data, count, channels, [](float, size_t c) {
+            return static_cast<float>(c);
+        });
+    });
+}
+
+// Applies the chain in pieces of the given size, like the kernels applying it to the output rows
+std::vector<float> applyByPieces(const PostOps& postOps, size_t size, size_t piece) {
+    std::vector<float> data(size, -1.f);
+    for (size_t offset = 0; offset < size; offset += piece)
+        postOps.apply(data.data() + offset, (std::min)(piece, size - offset), offset);
+    return data;
+}
+
+}  // namespace
+
+TEST(PostOpsTest, ChannelsOfPlanarLayout) {
+    const size_t N = 2, C = 3, H = 2, W = 5;
+    PostOps postOps(TensorDesc(Precision::FP32, {N, C, H, W}, Layout::NCHW));
+    appendChannelIndex(postOps);
+    ASSERT_EQ(C, postOps.channels());
+
+    for (size_t piece : {N * C * H * W, W, size_t(7), size_t(1)}) {
+        auto data = applyByPieces(postOps, N * C * H * W, piece);
+        for (size_t i = 0; i < data.size(); i++)
+            ASSERT_EQ(static_cast<float>((i / (H * W)) % C), data[i]) << "piece " << piece << ", offset " << i;
+    }
+}
+
+TEST(PostOpsTest, ChannelsOfNHWCLayout) {
+    const size_t N = 2, C = 5, H = 3, W = 2;
+    PostOps postOps(TensorDesc(Precision::FP32, {N, C, H, W}, Layout::NHWC));
+    appendChannelIndex(postOps);
+    ASSERT_EQ(C, postOps.channels());
+
+    for (size_t piece : {N * C * H * W, C, size_t(7), size_t(1)}) {
+        auto data = applyByPieces(postOps, N * C * H * W, piece);
+        for (size_t i = 0; i < data.size(); i++)
+            ASSERT_EQ(static_cast<float>(i % C), data[i]) << "piece " << piece << ", offset " << i;
+    }
+}
+
+TEST(PostOpsTest, ChannelsOfBlockedLayout) {
+    const size_t N = 2, C = 10, H = 3, W = 2, block = 8, CB = (C + block - 1) / block;
+    PostOps postOps(TensorDesc(Precision::FP32, {N, C, H, W}, BlockingDesc({N, CB, H, W, block}, {0, 1, 2, 3, 1})));
+    appendChannelIndex(postOps);
+    ASSERT_EQ(CB * block, postOps.channels());
+
+    const size_t size = N * CB * H * W * block;
+    for (size_t piece : {size, W * block, size_t(13), size_t(1)}) {
+        auto data = applyByPieces(postOps, size, piece);
+        for (size_t i = 0; i < data.size(); i++)
+            ASSERT_EQ(static_cast<float>(((i / (H * W * block)) % CB) * block + i % block), data[i])
+                    << "piece " << piece << ", offset " << i;
+    }
+}
+
+TEST(PostOpsTest, ChannelsOf2DLayout) {
+    const size_t N = 3, C = 7;
+    PostOps postOps(TensorDesc(Precision::FP32, {N, C}, Layout::NC));
+    appendChannelIndex(postOps);
+
+    auto data = applyByPieces(postOps, N * C, 4);
+    for (size_t i = 0; i < data.size(); i++)
+        ASSERT_EQ(static_cast<float>(i % C), data[i]);
+}
+
+TEST(PostOpsTest, OperationsAreAppliedInOrder) {
+    PostOps postOps(TensorDesc(Precision::FP32, {1, 2, 1, 2}, Layout::NCHW));
+    const auto scales = postOps.perChannel({2.f, 3.f});
+    postOps.append([scales](float* data, size_t count, const PostOps::Channels& channels) {
+        PostOps::forEach(data, count, channels, [&](float value, size_t c) { return value * scales[c]; });
+    });
+    postOps.append([](float* data, size_t count, const PostOps::Channels& channels) {
+        PostOps::forEach(data, count, channels, [](float value, size_t) { return value + 1.f; });
+    });
+
+    std::vector<float> data = {1.f, 2.f, 3.f, 4.f};
+    postOps.apply(data.data(), data.size(), 0);
+    ASSERT_EQ((std::vector<float>{3.f, 5.f, 10.f, 13.f}), data);
+}
+
+TEST(PostOpsTest, PerChannelParametersAreBroadcastedAndPadded) {
+    PostOps postOps(TensorDesc(Precision::FP32, {1, 3, 1, 1}, BlockingDesc({1, 1, 1, 1, 8}, {0, 1, 2, 3, 1})));
+    ASSERT_EQ(8, postOps.channels());
+    ASSERT_EQ(std::vector<float>(8, 5.f), postOps.perChannel({5.f}));
+    ASSERT_EQ((std::vector<float>{1.f, 2.f, 3.f, 3.f, 3.f, 3.f, 3.f, 3.f}), postOps.perChannel({1.f, 2.f, 3.f}));
+}
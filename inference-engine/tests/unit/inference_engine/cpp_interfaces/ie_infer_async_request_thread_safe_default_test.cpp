@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
 #include <deque>
+#include <future>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
@@ -262,6 +264,51 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
 }
 
 
+TEST_F(InferRequestThreadSafeDefaultTests, waitReportsExceptionOfLastStartedRequestOnly) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(2)
+            .WillOnce(Throw(std::exception()))
+            .WillOnce(Return());
+
+    testRequest->StartAsync();
+    EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
+    EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::STATUS_ONLY), std::exception);
+    testRequest->StartAsync();
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::RESULT_READY));
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::STATUS_ONLY));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, canStartAsyncFromCallback) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+
+    const int iterations = 100;
+    std::atomic<int> callbacks = {0};
+    std::promise<void> done;
+    InferRequest cppRequest(asyncRequest);
+    std::function<void(InferRequest, StatusCode)> callback =
+            [&](InferRequest request, StatusCode status) {
+                ASSERT_EQ(StatusCode::OK, status);
+                if (++callbacks < iterations) {
+                    request.StartAsync();
+                } else {
+                    done.set_value();
+                }
+            };
+    cppRequest.SetCompletionCallback(callback);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(iterations);
+
+    testRequest->StartAsync();
+    done.get_future().wait();
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::RESULT_READY));
+    ASSERT_EQ(iterations, callbacks);
+}
+
 class AsyncInferRequestThreadSafeInternalTests : public ::testing::Test {
 protected:
     MockAsyncInferRequestThreadSafeInternal::Ptr testRequest;
@@ -47,6 +47,7 @@ public:
 
 class NV12BlobTests : public CompoundBlobTests {};
 class I420BlobTests : public CompoundBlobTests {};
+class BatchedBlobTests : public CompoundBlobTests {};
 
 TEST(BlobConversionTests, canWorkWithMemoryBlob) {
     Blob::Ptr blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NCHW));
@@ -425,3 +426,59 @@ TEST_F(I420BlobTests, cannotCreateI420BlobFromPlanesWithWrongHeightRatio) {
 }
 
 
+
+TEST_F(BatchedBlobTests, cannotCreateBatchedBlobFromEmptyVector) {
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(std::vector<Blob::Ptr>()),
+        InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedBlobTests, cannotCreateBatchedBlobFromNullptr) {
+    Blob::Ptr valid = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NCHW));
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(std::vector<Blob::Ptr>({valid, nullptr})),
+        InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedBlobTests, cannotCreateBatchedBlobFromBlobsWithDifferentDims) {
+    Blob::Ptr blob1 = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NCHW));
+    Blob::Ptr blob2 = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 6, 4}, NCHW));
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(std::vector<Blob::Ptr>({blob1, blob2})),
+        InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedBlobTests, cannotCreateBatchedBlobFromBlobsWithBatch) {
+    Blob::Ptr blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {2, 3, 4, 4}, NCHW));
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(std::vector<Blob::Ptr>({blob, blob})),
+        InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedBlobTests, cannotCreateBatchedBlobFromMixedBlobs) {
+    Blob::Ptr y_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 6, 8}, NHWC));
+    Blob::Ptr uv_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 2, 3, 4}, NHWC));
+    Blob::Ptr nv12_blob = make_shared_blob<NV12Blob>(y_blob, uv_blob);
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(std::vector<Blob::Ptr>({nv12_blob, y_blob})),
+        InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedBlobTests, canCreateBatchedBlobFromMemoryBlobs) {
+    Blob::Ptr blob1 = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NHWC));
+    Blob::Ptr blob2 = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NHWC));
+    BlobPtrs blobs = {blob1, blob2};
+
+    _test_blob = make_shared_blob<BatchedBlob>(blobs);
+    verifyCompoundBlob(_test_blob, blobs);
+    EXPECT_TRUE(_test_blob->is<BatchedBlob>());
+    EXPECT_EQ(TensorDesc(Precision::U8, {2, 3, 4, 4}, NHWC), _test_blob->getTensorDesc());
+}
+
+TEST_F(BatchedBlobTests, canCreateBatchedBlobFromNV12Blobs) {
+    BlobPtrs blobs;
+    for (int i = 0; i < 3; ++i) {
+        blobs.push_back(make_shared_blob<NV12Blob>(
+            make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 6, 8}, NHWC)),
+            make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 2, 3, 4}, NHWC))));
+    }
+
+    _test_blob = make_shared_blob<BatchedBlob>(blobs);
+    verifyCompoundBlob(_test_blob, blobs);
+    EXPECT_EQ(TensorDesc(Precision::U8, {3, 1, 6, 8}, NCHW), _test_blob->getTensorDesc());
+}
@@ -895,6 +895,77 @@ TEST_P(ColorConvertYUV420TestIE, AccuracyTest)
     }
 }
 
+TEST_P(ColorConvertYUV420TestIE, BatchedAccuracyTest)
+{
+    using namespace InferenceEngine;
+    const int depth = CV_8U;
+    auto in_fmt = ColorFormat::NV12;
+    const auto out_fmt = ColorFormat::BGR;  // for now, always BGR
+    auto out_layout = Layout::ANY;
+    cv::Size size;
+    double tolerance = 0.0;
+    std::tie(in_fmt, out_layout, size, tolerance) = GetParam();
+
+    const size_t batch = 3;
+    std::vector<cv::Mat> in_mats_y, in_mats_uv;
+    std::vector<Blob::Ptr> frames;
+    for (size_t i = 0; i < batch; i++) {
+        cv::Mat in_mat_y(size, CV_MAKE_TYPE(depth, 1));
+        cv::Mat in_mat_uv(cv::Size(size.width / 2, size.height / 2), CV_MAKE_TYPE(depth, 2));
+        cv::randn(in_mat_y, cv::Scalar::all(127), cv::Scalar::all(40.f));
+        cv::randn(in_mat_uv, cv::Scalar::all(127 / 2), cv::Scalar::all(40.f / 2));
+
+        auto y_blob = img2Blob<Precision::U8>(in_mat_y, Layout::NHWC);
+        if (in_fmt == ColorFormat::NV12) {
+            auto uv_blob = img2Blob<Precision::U8>(in_mat_uv, Layout::NHWC);
+            frames.push_back(make_shared_blob<NV12Blob>(y_blob, uv_blob));
+        } else {
+            cv::Mat in_mat_u(cv::Size(size.width / 2, size.height / 2), CV_MAKE_TYPE(depth, 1));
+            cv::Mat in_mat_v(cv::Size(size.width / 2, size.height / 2), CV_MAKE_TYPE(depth, 1));
+            std::array<cv::Mat, 2> in_uv = {in_mat_u, in_mat_v};
+            cv::split(in_mat_uv, in_uv);
+            auto u_blob = img2Blob<Precision::U8>(in_mat_u, Layout::NHWC);
+            auto v_blob = img2Blob<Precision::U8>(in_mat_v, Layout::NHWC);
+            frames.push_back(make_shared_blob<I420Blob>(y_blob, u_blob, v_blob));
+        }
+        in_mats_y.push_back(in_mat_y);
+        in_mats_uv.push_back(in_mat_uv);
+    }
+
+    // Inference Engine code ///////////////////////////////////////////////////
+
+    const size_t out_channels = numChannels(out_fmt);
+    const size_t frame_size = out_channels * size.height * size.width;
+    auto out_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8,
+        {batch, out_channels, static_cast<size_t>(size.height), static_cast<size_t>(size.width)}, out_layout));
+    out_blob->allocate();
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(make_shared_blob<BatchedBlob>(frames));
+
+    PreProcessInfo info;
+    info.setColorFormat(in_fmt);
+
+    Blob::Ptr out = out_blob;
+    preprocess->execute(out, info, false);
+
+    // OpenCV code and comparison //////////////////////////////////////////////
+    for (size_t i = 0; i < batch; i++) {
+        cv::Mat out_mat(size, CV_MAKE_TYPE(depth, out_channels));
+        cv::Mat out_mat_ocv(size, CV_MAKE_TYPE(depth, out_channels));
+
+        auto frame_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8,
+            {1, out_channels, static_cast<size_t>(size.height), static_cast<size_t>(size.width)}, out_layout),
+            out_blob->buffer().as<uint8_t*>() + i * frame_size);
+        Blob2Img<Precision::U8>(frame_blob, out_mat, out_layout);
+
+        //for both I420 and NV12 use NV12 as I420 is not supported by OCV
+        cv::cvtColorTwoPlane(in_mats_y[i], in_mats_uv[i], out_mat_ocv, toCvtColorCode(ColorFormat::NV12, out_fmt));
+
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat, cv::NORM_INF), tolerance) << "frame " << i;
+    }
+}
+
 TEST_P(SplitTestIE, AccuracyTest)
 {
     const auto params = GetParam();
@@ -523,6 +523,24 @@ static std::vector<float> boxes = { 0.0, 0.0, 1.0, 1.0, 0.0, 0.1, 1.0, 1.1, 0.0,
 static std::vector<float> scores = { 0.9f, 0.75f, 0.6f, 0.95f, 0.5f, 0.3f };
 static std::vector<int> reference = { 0,0,3,0,0,0,0,0,5 };
 
+// 20 disjoint boxes followed by 4 duplicates, more selected boxes than one SIMD block
+static std::vector<float> grid_boxes = [] {
+    std::vector<float> b;
+    for (int i = 0; i < 24; i++) {
+        float y = static_cast<float>(i % 20) * 2.f;
+        b.insert(b.end(), { y, 0.f, y + 1.f, 1.f });
+    }
+    return b;
+}();
+static std::vector<float> grid_scores = [] {
+    std::vector<float> s;
+    for (int i = 0; i < 24; i++)
+        s.push_back(0.5f + 0.01f * i);
+    for (int i = 0; i < 24; i++)
+        s.push_back(0.9f - 0.01f * i);
+    return s;
+}();
+
 INSTANTIATE_TEST_CASE_P(
         TestsNonMaxSuppression, MKLDNNCPUExtNonMaxSuppressionTFTests,
         ::testing::Values(
@@ -564,5 +582,7 @@ INSTANTIATE_TEST_CASE_P(
 
             nmsTF_test_params{ 0, 1, { 1,1,6 }, boxes, scores, { 3 }, {}, {}, 3, { 0,0,3,0,0,0,0,0,1 } }, /*nonmaxsuppression_no_iou_threshold_and_score_threshold*/
 
-            nmsTF_test_params{ 0, 1, { 1,1,6 }, boxes, scores, {}, {}, {}, 3, {} } /*nonmaxsuppression_no_max_output_boxes_per_class_and_iou_threshold_and_score_threshold*/
+            nmsTF_test_params{ 0, 1, { 1,1,6 }, boxes, scores, {}, {}, {}, 3, {} }, /*nonmaxsuppression_no_max_output_boxes_per_class_and_iou_threshold_and_score_threshold*/
+
+            nmsTF_test_params{ 0, 0, { 1,2,24 }, grid_boxes, grid_scores, { 30 }, { 0.5 }, { 0.0 }, 40, {} } /*nonmaxsuppression_many_selected_boxes*/
 ));
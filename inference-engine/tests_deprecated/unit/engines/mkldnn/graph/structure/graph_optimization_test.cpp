@@ -6,6 +6,7 @@
 
 #include "single_layer_common.hpp"
 #include <mkldnn_extension_mngr.h>
+#include <nodes/mkldnn_reorder_node.h>
 #include "tests_common.hpp"
 #include <ie_core.hpp>
 
@@ -422,3 +423,220 @@ TEST_F(MKLDNNGraphOptimizationTests, TestNoFuseCustomActivation) {
     }
     ASSERT_FALSE(fused);
 }
+
+TEST_F(MKLDNNGraphOptimizationTests, TestLayoutOptimizationsReorderSharedOutputOnce) {
+    // ReLU selects the layout of the input, both convolutions prefer a blocked one. Switching ReLU to the blocked
+    // layout needs a single reorder of its input instead of a reorder on every output edge
+    std::string model = R"V0G0N(
+<net name="SharedOutput" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="relu" type="ReLU" precision="FP32" id="1">
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv1" type="Convolution" precision="FP32" id="2">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="16" group="1"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="0" size="1024"/>
+            <biases offset="1024" size="64"/>
+        </layer>
+        <layer name="conv2" type="Convolution" precision="FP32" id="3">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="16" group="1"/>
+            <input>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="1088" size="1024"/>
+            <biases offset="2112" size="64"/>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="1" from-port="2" to-layer="3" to-port="5"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>({ InferenceEngine::Precision::U8, {2176}, InferenceEngine::C });
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+    InferenceEngine::Core core;
+    InferenceEngine::CNNNetwork network;
+    ASSERT_NO_THROW(network = core.ReadNetwork(model, weights_ptr));
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(network));
+
+    size_t reorders = 0;
+    for (auto &node : graph.getNodes()) {
+        if (node->getType() == MKLDNNPlugin::Reorder && node->getChildEdgeAt(0)->getChild()->getType() != MKLDNNPlugin::Output)
+            reorders++;
+    }
+    ASSERT_LE(reorders, 1);
+}
+
+namespace {
+
+// Input -> Reorder -> ... -> Reorder -> Output, where the i-th reorder converts descs[i] to descs[i + 1]
+class ReorderChainGraph : public MKLDNNGraphTestClass {
+public:
+    std::vector<std::shared_ptr<MKLDNNPlugin::MKLDNNReorderNode>> create(const std::vector<InferenceEngine::TensorDesc>& descs) {
+        MKLDNNPlugin::MKLDNNWeightsSharing::Ptr cache;
+
+        inData = std::make_shared<InferenceEngine::Data>("in", descs.front());
+        InferenceEngine::CNNLayerPtr inLayer(new InferenceEngine::CNNLayer({"in", "Input", InferenceEngine::Precision::FP32}));
+        inLayer->outData.push_back(inData);
+        outData = std::make_shared<InferenceEngine::Data>("out", descs.back());
+        InferenceEngine::CNNLayerPtr outLayer(new InferenceEngine::CNNLayer({"out", "Output", InferenceEngine::Precision::FP32}));
+        outLayer->insData.push_back(outData);
+
+        std::vector<MKLDNNPlugin::MKLDNNNodePtr> nodes;
+        std::vector<std::shared_ptr<MKLDNNPlugin::MKLDNNReorderNode>> reorders;
+        nodes.emplace_back(new MKLDNNPlugin::MKLDNNInputNode(inLayer, getEngine(), cache));
+        for (size_t i = 0; i + 1 < descs.size(); i++) {
+            InferenceEngine::CNNLayerPtr layer(new InferenceEngine::CNNLayer({"reorder" + std::to_string(i), "Reorder",
+                                                                              InferenceEngine::Precision::FP32}));
+            auto reorder = std::make_shared<MKLDNNPlugin::MKLDNNReorderNode>(layer, getEngine(), cache);
+            reorder->setDescs(descs[i], descs[i + 1]);
+            reorders.push_back(reorder);
+            nodes.push_back(reorder);
+        }
+        nodes.emplace_back(new MKLDNNPlugin::MKLDNNInputNode(outLayer, getEngine(), cache));
+
+        for (size_t i = 0; i + 1 < nodes.size(); i++) {
+            MKLDNNPlugin::MKLDNNEdgePtr edge(new MKLDNNPlugin::MKLDNNEdge(nodes[i], nodes[i + 1], 0, 0));
+            nodes[i]->addEdge(edge);
+            GetEdges().push_back(edge);
+        }
+        for (auto &node : nodes)
+            node->getSupportedDescriptors();
+        for (auto &node : nodes) {
+            node->initSupportedPrimitiveDescriptors();
+            node->selectOptimalPrimitiveDescriptor();
+            GetNodes().push_back(node);
+        }
+        return reorders;
+    }
+
+    std::vector<MKLDNNPlugin::MKLDNNReorderNode*> getReorders() {
+        std::vector<MKLDNNPlugin::MKLDNNReorderNode*> reorders;
+        for (auto &node : GetNodes()) {
+            if (node->getType() == MKLDNNPlugin::Reorder)
+                reorders.push_back(dynamic_cast<MKLDNNPlugin::MKLDNNReorderNode*>(node.get()));
+        }
+        return reorders;
+    }
+
+private:
+    InferenceEngine::DataPtr inData, outData;
+};
+
+const InferenceEngine::SizeVector chainDims = {1, 16, 4, 4};
+const InferenceEngine::TensorDesc nchw(InferenceEngine::Precision::FP32, chainDims, InferenceEngine::NCHW);
+const InferenceEngine::TensorDesc nhwc(InferenceEngine::Precision::FP32, chainDims, InferenceEngine::NHWC);
+const InferenceEngine::TensorDesc nChw8c(InferenceEngine::Precision::FP32, chainDims,
+                                         InferenceEngine::BlockingDesc({1, 2, 4, 4, 8}, {0, 1, 2, 3, 1}));
+
+InferenceEngine::Blob::Ptr makeScales() {
+    auto scales = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {16}, InferenceEngine::C});
+    scales->allocate();
+    float* data = scales->buffer().as<float*>();
+    for (size_t i = 0; i < scales->size(); i++)
+        data[i] = 0.5f + i;
+    return scales;
+}
+
+}  // namespace
+
+TEST_F(MKLDNNGraphOptimizationTests, TestDropReorderChain) {
+    // The first pass merges the first two reorders, the next one merges the result with the last reorder,
+    // which converts the data back to the input layout, so no reorder is left at all
+    ReorderChainGraph graph;
+    graph.create({nchw, nhwc, nChw8c, nchw});
+
+    ASSERT_NO_THROW(MKLDNNPlugin::MKLDNNGraphOptimizer().ApplyImplSpecificGraphOptimizations(graph));
+    ASSERT_TRUE(graph.getReorders().empty());
+    ASSERT_EQ(3, graph.eliminatedReorders);
+}
+
+TEST_F(MKLDNNGraphOptimizationTests, TestMergeReorderChainKeepsScales) {
+    ReorderChainGraph graph;
+    auto reorders = graph.create({nchw, nhwc, nchw});
+    auto scales = makeScales();
+    reorders[0]->_scales = scales;
+
+    ASSERT_NO_THROW(MKLDNNPlugin::MKLDNNGraphOptimizer().ApplyImplSpecificGraphOptimizations(graph));
+    auto remaining = graph.getReorders();
+    ASSERT_EQ(1, remaining.size());
+    ASSERT_EQ(scales, remaining[0]->_scales);
+    ASSERT_EQ(1, graph.eliminatedReorders);
+}
+
+TEST_F(MKLDNNGraphOptimizationTests, TestNoMergeOfReordersWithScales) {
+    // Merging scales of two subsequent reorders is unsupported, the pair is kept instead of failing the compilation
+    ReorderChainGraph graph;
+    auto reorders = graph.create({nchw, nhwc, nChw8c, nchw});
+    reorders[0]->_scales = makeScales();
+    reorders[1]->_scales = makeScales();
+
+    ASSERT_NO_THROW(MKLDNNPlugin::MKLDNNGraphOptimizer().ApplyImplSpecificGraphOptimizations(graph));
+    // the second reorder with scales is merged with the last one only
+    auto remaining = graph.getReorders();
+    ASSERT_EQ(2, remaining.size());
+    for (auto reorder : remaining)
+        ASSERT_NE(nullptr, reorder->_scales);
+}
@@ -0,0 +1,862 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/attribute_visitor.hpp"
+#include "ngraph/binary_serializer.hpp"
+#include "ngraph/factory.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/opsets/opset.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    const char binary_format_magic[8] = {'N', 'G', 'R', 'A', 'P', 'H', 'B', 'F'};
+    const uint32_t byte_order_mark = 0x01020304;
+    const size_t data_alignment = 64;
+
+    struct Header
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t byte_order;
+        uint64_t graph_offset;
+        uint64_t graph_size;
+        uint64_t data_offset;
+        uint64_t data_size;
+        uint64_t reserved[2];
+    };
+    static_assert(sizeof(Header) == data_alignment, "Binary function header must keep alignment");
+
+    uint64_t align(uint64_t offset)
+    {
+        return (offset + data_alignment - 1) / data_alignment * data_alignment;
+    }
+
+    // Tag of every serialized attribute, checked against the adapter type when reading
+    enum class AttributeKind : uint8_t
+    {
+        string,
+        boolean,
+        i64,
+        f64,
+        vector_i8,
+        vector_i16,
+        vector_i32,
+        vector_i64,
+        vector_u8,
+        vector_u16,
+        vector_u32,
+        vector_u64,
+        vector_f32,
+        vector_f64,
+        vector_string,
+        raw
+    };
+
+    class Writer
+    {
+    public:
+        size_t size() const { return m_buffer.size(); }
+        const char* data() const { return m_buffer.data(); }
+        void write_bytes(const void* data, size_t size)
+        {
+            auto bytes = static_cast<const char*>(data);
+            m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+        }
+
+        template <typename T>
+        void write(const T& value)
+        {
+            write_bytes(&value, sizeof(T));
+        }
+
+        /// Overwrites a value written before at position
+        template <typename T>
+        void patch(size_t position, const T& value)
+        {
+            memcpy(&m_buffer[position], &value, sizeof(T));
+        }
+
+        // The terminating zero is kept, so that strings can be used in place by the reader
+        void write_string(const string& value)
+        {
+            write<uint64_t>(value.size());
+            write_bytes(value.c_str(), value.size() + 1);
+        }
+
+        template <typename T>
+        void write_vector(const vector<T>& values)
+        {
+            write<uint64_t>(values.size());
+            write_bytes(values.data(), values.size() * sizeof(T));
+        }
+
+        void write_vector(const vector<string>& values)
+        {
+            write<uint64_t>(values.size());
+            for (auto& value : values)
+            {
+                write_string(value);
+            }
+        }
+
+    private:
+        vector<char> m_buffer;
+    };
+
+    class Reader
+    {
+    public:
+        Reader() = default;
+        Reader(const char* begin, const char* end)
+            : m_pos(begin)
+            , m_end(end)
+        {
+        }
+
+        bool at_end() const { return m_pos == m_end; }
+        size_t remaining() const { return m_end - m_pos; }
+        const char* read_bytes(size_t size)
+        {
+            NGRAPH_CHECK(size <= remaining(), "Binary function is truncated");
+            auto pos = m_pos;
+            m_pos += size;
+            return pos;
+        }
+
+        template <typename T>
+        T read()
+        {
+            T value;
+            memcpy(&value, read_bytes(sizeof(T)), sizeof(T));
+            return value;
+        }
+
+        const char* read_c_str(size_t& size)
+        {
+            size = read<uint64_t>();
+            NGRAPH_CHECK(size < remaining() && m_pos[size] == 0,
+                         "Malformed string in binary function");
+            return read_bytes(size + 1);
+        }
+
+        const char* read_c_str()
+        {
+            size_t size;
+            return read_c_str(size);
+        }
+
+        string read_string()
+        {
+            size_t size;
+            auto str = read_c_str(size);
+            return string(str, size);
+        }
+
+        template <typename T>
+        vector<T> read_vector()
+        {
+            auto size = read<uint64_t>();
+            NGRAPH_CHECK(size <= remaining() / sizeof(T), "Binary function is truncated");
+            vector<T> values(size);
+            if (size > 0)
+            {
+                memcpy(values.data(), read_bytes(size * sizeof(T)), size * sizeof(T));
+            }
+            return values;
+        }
+
+        vector<string> read_string_vector()
+        {
+            auto size = read<uint64_t>();
+            NGRAPH_CHECK(size <= remaining(), "Binary function is truncated");
+            vector<string> values(size);
+            for (auto& value : values)
+            {
+                value = read_string();
+            }
+            return values;
+        }
+
+    private:
+        const char* m_pos{nullptr};
+        const char* m_end{nullptr};
+    };
+
+    // Ids of the function nodes used for node attributes, the ones of nodes registered by
+    // attributes themselves (such as lambda bodies) are their friendly names
+    string function_node_id(uint64_t index) { return "#" + to_string(index); }
+
+    /// Writes the node attributes as a list of named and typed values
+    class AttributeWriter : public AttributeVisitor
+    {
+    public:
+        AttributeWriter(Writer& writer, const unordered_map<const Node*, uint64_t>& node_ids)
+            : m_writer(writer)
+            , m_node_ids(node_ids)
+        {
+        }
+
+        void write_attributes(Node& node)
+        {
+            auto count_position = m_writer.size();
+            m_count = 0;
+            m_writer.write<uint32_t>(0);
+            NGRAPH_CHECK(node.visit_attributes(*this),
+                         "Node ",
+                         node,
+                         " does not support attribute visiting and cannot be serialized");
+            m_writer.patch<uint32_t>(count_position, m_count);
+        }
+
+        void on_adapter(const string& name, ValueAccessor<void>& adapter) override
+        {
+            NGRAPH_CHECK(false, "Attribute \"", name, "\" cannot be serialized");
+        }
+        void on_adapter(const string& name, ValueAccessor<void*>& adapter) override
+        {
+            start(name, AttributeKind::raw);
+            m_writer.write<uint64_t>(adapter.size());
+            m_writer.write_bytes(adapter.get_ptr(), adapter.size());
+            finish();
+        }
+        void on_adapter(const string& name, ValueAccessor<string>& adapter) override
+        {
+            start(name, AttributeKind::string);
+            m_writer.write_string(adapter.get());
+            finish();
+        }
+        void on_adapter(const string& name, ValueAccessor<bool>& adapter) override
+        {
+            start(name, AttributeKind::boolean);
+            m_writer.write<uint8_t>(adapter.get() ? 1 : 0);
+            finish();
+        }
+        void on_adapter(const string& name, ValueAccessor<int64_t>& adapter) override
+        {
+            write_value(name, AttributeKind::i64, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<double>& adapter) override
+        {
+            write_value(name, AttributeKind::f64, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int8_t>>& adapter) override
+        {
+            write_vector(name, AttributeKind::vector_i8, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int16_t>>& adapter) override
+        {
+            write_vector(name, AttributeKind::vector_i16, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int32_t>>& adapter) override
+        {
+            write_vector(name, AttributeKind::vector_i32, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int64_t>>& adapter) override
+        {
+            write_vector(name, AttributeKind::vector_i64, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint8_t>>& adapter) override
+        {
+            write_vector(name, AttributeKind::vector_u8, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint16_t>>& adapter) override
+        {
+            write_vector(name, AttributeKind::vector_u16, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint32_t>>& adapter) override
+        {
+            write_vector(name, AttributeKind::vector_u32, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint64_t>>& adapter) override
+        {
+            write_vector(name, AttributeKind::vector_u64, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<float>>& adapter) override
+        {
+            write_vector(name, AttributeKind::vector_f32, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<double>>& adapter) override
+        {
+            write_vector(name, AttributeKind::vector_f64, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<string>>& adapter) override
+        {
+            write_vector(name, AttributeKind::vector_string, adapter);
+        }
+
+        node_id_t get_registered_node_id(const shared_ptr<Node>& node) override
+        {
+            auto it = m_node_ids.find(node.get());
+            return it == m_node_ids.end() ? AttributeVisitor::get_registered_node_id(node)
+                                          : function_node_id(it->second);
+        }
+
+    private:
+        // Every value is prefixed with its size, so that the reader can index the attributes
+        // without knowing their types
+        void start(const string& name, AttributeKind kind)
+        {
+            m_writer.write_string(name);
+            m_writer.write(kind);
+            m_size_position = m_writer.size();
+            m_writer.write<uint64_t>(0);
+            m_count++;
+        }
+
+        void finish()
+        {
+            m_writer.patch<uint64_t>(m_size_position,
+                                     m_writer.size() - m_size_position - sizeof(uint64_t));
+        }
+
+        template <typename T>
+        void write_value(const string& name, AttributeKind kind, ValueAccessor<T>& adapter)
+        {
+            start(name, kind);
+            m_writer.write(adapter.get());
+            finish();
+        }
+
+        template <typename T>
+        void write_vector(const string& name, AttributeKind kind, ValueAccessor<T>& adapter)
+        {
+            start(name, kind);
+            m_writer.write_vector(adapter.get());
+            finish();
+        }
+
+        Writer& m_writer;
+        const unordered_map<const Node*, uint64_t>& m_node_ids;
+        uint32_t m_count{0};
+        size_t m_size_position{0};
+    };
+
+    /// Sets the node attributes from the list written by AttributeWriter
+    class AttributeReader : public AttributeVisitor
+    {
+    public:
+        AttributeReader(const vector<shared_ptr<Node>>& nodes)
+            : m_nodes(nodes)
+        {
+        }
+
+        void read_attributes(Reader& reader, Node& node)
+        {
+            m_attributes.clear();
+            m_next = 0;
+            auto count = reader.read<uint32_t>();
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                Attribute attribute;
+                attribute.name = reader.read_c_str();
+                attribute.kind = reader.read<AttributeKind>();
+                auto size = reader.read<uint64_t>();
+                auto value = reader.read_bytes(size);
+                attribute.value = Reader(value, value + size);
+                m_attributes.push_back(attribute);
+            }
+            NGRAPH_CHECK(node.visit_attributes(*this),
+                         "Node ",
+                         node,
+                         " does not support attribute visiting and cannot be deserialized");
+        }
+
+        void on_adapter(const string& name, ValueAccessor<void>& adapter) override
+        {
+            NGRAPH_CHECK(false, "Attribute \"", name, "\" cannot be deserialized");
+        }
+        void on_adapter(const string& name, ValueAccessor<void*>& adapter) override
+        {
+            auto value = find(name, AttributeKind::raw);
+            auto size = value.read<uint64_t>();
+            NGRAPH_CHECK(size == adapter.size(),
+                         "Attribute \"",
+                         name,
+                         "\" has ",
+                         size,
+                         " bytes in binary function, ",
+                         adapter.size(),
+                         " expected");
+            memcpy(adapter.get_ptr(), value.read_bytes(size), size);
+        }
+        void on_adapter(const string& name, ValueAccessor<string>& adapter) override
+        {
+            adapter.set(find(name, AttributeKind::string).read_string());
+        }
+        void on_adapter(const string& name, ValueAccessor<bool>& adapter) override
+        {
+            adapter.set(find(name, AttributeKind::boolean).read<uint8_t>() != 0);
+        }
+        void on_adapter(const string& name, ValueAccessor<int64_t>& adapter) override
+        {
+            adapter.set(find(name, AttributeKind::i64).read<int64_t>());
+        }
+        void on_adapter(const string& name, ValueAccessor<double>& adapter) override
+        {
+            adapter.set(find(name, AttributeKind::f64).read<double>());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int8_t>>& adapter) override
+        {
+            adapter.set(find(name, AttributeKind::vector_i8).read_vector<int8_t>());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int16_t>>& adapter) override
+        {
+            adapter.set(find(name, AttributeKind::vector_i16).read_vector<int16_t>());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int32_t>>& adapter) override
+        {
+            adapter.set(find(name, AttributeKind::vector_i32).read_vector<int32_t>());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int64_t>>& adapter) override
+        {
+            adapter.set(find(name, AttributeKind::vector_i64).read_vector<int64_t>());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint8_t>>& adapter) override
+        {
+            adapter.set(find(name, AttributeKind::vector_u8).read_vector<uint8_t>());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint16_t>>& adapter) override
+        {
+            adapter.set(find(name, AttributeKind::vector_u16).read_vector<uint16_t>());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint32_t>>& adapter) override
+        {
+            adapter.set(find(name, AttributeKind::vector_u32).read_vector<uint32_t>());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint64_t>>& adapter) override
+        {
+            adapter.set(find(name, AttributeKind::vector_u64).read_vector<uint64_t>());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<float>>& adapter) override
+        {
+            adapter.set(find(name, AttributeKind::vector_f32).read_vector<float>());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<double>>& adapter) override
+        {
+            adapter.set(find(name, AttributeKind::vector_f64).read_vector<double>());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<string>>& adapter) override
+        {
+            adapter.set(find(name, AttributeKind::vector_string).read_string_vector());
+        }
+
+        shared_ptr<Node> get_registered_node(node_id_t id) override
+        {
+            if (id.size() > 1 && id[0] == '#')
+            {
+                auto index = stoull(id.substr(1));
+                NGRAPH_CHECK(index < m_nodes.size(), "Invalid node id ", id, " in binary function");
+                return m_nodes[index];
+            }
+            return AttributeVisitor::get_registered_node(id);
+        }
+
+    private:
+        struct Attribute
+        {
+            const char* name;
+            AttributeKind kind;
+            Reader value;
+        };
+
+        Reader find(const string& name, AttributeKind kind)
+        {
+            // The attributes are visited in the order they were written, so the search starts
+            // after the previous match
+            for (size_t i = 0; i < m_attributes.size(); ++i)
+            {
+                auto& attribute = m_attributes[(m_next + i) % m_attributes.size()];
+                if (name == attribute.name)
+                {
+                    NGRAPH_CHECK(attribute.kind == kind,
+                                 "Attribute \"",
+                                 name,
+                                 "\" has a different type in binary function");
+                    m_next = (m_next + i + 1) % m_attributes.size();
+                    return attribute.value;
+                }
+            }
+            throw ngraph_error("Attribute \"" + name + "\" is missing in binary function");
+        }
+
+        const vector<shared_ptr<Node>>& m_nodes;
+        vector<Attribute> m_attributes;
+        size_t m_next{0};
+    };
+
+    /// Read-only copy-on-write mapping of a whole file
+    class MappedFile
+    {
+    public:
+        explicit MappedFile(const string& path)
+        {
+#ifdef _WIN32
+            HANDLE file = CreateFileA(path.c_str(),
+                                      GENERIC_READ,
+                                      FILE_SHARE_READ,
+                                      nullptr,
+                                      OPEN_EXISTING,
+                                      FILE_ATTRIBUTE_NORMAL,
+                                      nullptr);
+            NGRAPH_CHECK(file != INVALID_HANDLE_VALUE, "Cannot open ", path);
+            LARGE_INTEGER file_size;
+            if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0)
+            {
+                m_size = static_cast<size_t>(file_size.QuadPart);
+                HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+                if (mapping != nullptr)
+                {
+                    m_data = static_cast<char*>(MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0));
+                    CloseHandle(mapping);
+                }
+            }
+            CloseHandle(file);
+#else
+            int fd = open(path.c_str(), O_RDONLY);
+            NGRAPH_CHECK(fd >= 0, "Cannot open ", path);
+            struct stat st;
+            if (fstat(fd, &st) == 0 && st.st_size > 0)
+            {
+                m_size = static_cast<size_t>(st.st_size);
+                // Private writable pages, so that the constants may still be modified in place
+                void* data = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+                m_data = data == MAP_FAILED ? nullptr : static_cast<char*>(data);
+            }
+            close(fd);
+#endif
+            NGRAPH_CHECK(m_data != nullptr, "Cannot map ", path);
+        }
+
+        ~MappedFile()
+        {
+#ifdef _WIN32
+            UnmapViewOfFile(m_data);
+#else
+            munmap(m_data, m_size);
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        char* data() const { return m_data; }
+        size_t size() const { return m_size; }
+    private:
+        char* m_data{nullptr};
+        size_t m_size{0};
+    };
+
+    void check_header(const Header& header)
+    {
+        NGRAPH_CHECK(memcmp(header.magic, binary_format_magic, sizeof(binary_format_magic)) == 0,
+                     "Not a binary function");
+        NGRAPH_CHECK(header.byte_order == byte_order_mark,
+                     "Binary function was written with a different byte order");
+        NGRAPH_CHECK(header.version == binary_format_version,
+                     "Binary function has version ",
+                     header.version,
+                     ", version ",
+                     binary_format_version,
+                     " is supported");
+        NGRAPH_CHECK(header.graph_offset >= sizeof(Header) &&
+                         header.data_offset >= header.graph_offset &&
+                         header.graph_size <= header.data_offset - header.graph_offset &&
+                         header.data_offset % data_alignment == 0 &&
+                         header.data_size <= UINT64_MAX - header.data_offset,
+                     "Malformed binary function header");
+    }
+
+    /// Creates an operation of the given type. Operations of the newer opsets, like v3::TopK, are
+    /// not in the op version table, so they are looked up in the opsets.
+    shared_ptr<Node> create_node(const NodeTypeInfo& type_info)
+    {
+        shared_ptr<Node> node(FactoryRegistry<Node>::get().create(type_info));
+        for (auto opset : {&get_opset4(), &get_opset3(), &get_opset2(), &get_opset1()})
+        {
+            if (node)
+            {
+                break;
+            }
+            if (opset->contains_type(type_info))
+            {
+                node.reset(opset->create(type_info.name));
+                if (node && node->get_type_info() != type_info)
+                {
+                    node.reset();
+                }
+            }
+        }
+        return node;
+    }
+
+    /// Builds the function from the serialized data, owner keeps the data alive for constants
+    shared_ptr<Function> read_function(char* data, size_t size, const shared_ptr<void>& owner)
+    {
+        NGRAPH_CHECK(size >= sizeof(Header), "Binary function is truncated");
+        Header header;
+        memcpy(&header, data, sizeof(Header));
+        check_header(header);
+        NGRAPH_CHECK(header.data_offset + header.data_size <= size, "Binary function is truncated");
+
+        Reader graph(data + header.graph_offset, data + header.graph_offset + header.graph_size);
+        auto name = graph.read_string();
+        auto count = graph.read<uint64_t>();
+        NGRAPH_CHECK(count <= graph.remaining(), "Binary function is truncated");
+
+        vector<shared_ptr<Node>> nodes;
+        nodes.reserve(count);
+        auto read_node = [&]() {
+            auto id = graph.read<uint64_t>();
+            NGRAPH_CHECK(id < nodes.size(), "Invalid node id ", id, " in binary function");
+            return nodes[id];
+        };
+
+        AttributeReader attribute_reader(nodes);
+        OutputVector arguments;
+        NodeVector control_dependencies;
+        for (uint64_t i = 0; i < count; ++i)
+        {
+            NodeTypeInfo type_info;
+            type_info.name = graph.read_c_str();
+            type_info.version = graph.read<uint64_t>();
+            auto friendly_name = graph.read_string();
+
+            arguments.resize(graph.read<uint32_t>());
+            for (auto& argument : arguments)
+            {
+                auto source = read_node();
+                auto index = graph.read<uint32_t>();
+                NGRAPH_CHECK(index < source->get_output_size(),
+                             "Invalid input of ",
+                             friendly_name,
+                             " in binary function");
+                argument = source->output(index);
+            }
+            control_dependencies.resize(graph.read<uint32_t>());
+            for (auto& dependency : control_dependencies)
+            {
+                dependency = read_node();
+            }
+
+            shared_ptr<Node> node;
+            if (type_info == op::Constant::type_info)
+            {
+                element::Type element_type;
+                AttributeAdapter<element::Type>(element_type).set(graph.read_string());
+                auto dims = graph.read_vector<uint64_t>();
+                auto offset = graph.read<uint64_t>();
+                auto byte_size = graph.read<uint64_t>();
+                NGRAPH_CHECK(offset <= header.data_size && byte_size <= header.data_size - offset,
+                             "Data of ",
+                             friendly_name,
+                             " is out of the binary function");
+                auto buffer = make_shared<runtime::SharedBuffer<shared_ptr<void>>>(
+                    data + header.data_offset + offset, byte_size, owner);
+                node = make_shared<op::Constant>(
+                    element_type, Shape(dims.begin(), dims.end()), buffer);
+            }
+            else
+            {
+                node = create_node(type_info);
+                NGRAPH_CHECK(node,
+                             "Unknown operation ",
+                             type_info.name,
+                             " version ",
+                             type_info.version,
+                             " in binary function");
+                attribute_reader.read_attributes(graph, *node);
+                node->set_arguments(arguments);
+                node->constructor_validate_and_infer_types();
+            }
+            for (auto& dependency : control_dependencies)
+            {
+                node->add_control_dependency(dependency);
+            }
+            node->set_friendly_name(friendly_name);
+            nodes.push_back(node);
+        }
+
+        ResultVector results(graph.read<uint32_t>());
+        for (auto& result : results)
+        {
+            result = as_type_ptr<op::Result>(read_node());
+            NGRAPH_CHECK(result, "Invalid result in binary function");
+        }
+        ParameterVector parameters(graph.read<uint32_t>());
+        for (auto& parameter : parameters)
+        {
+            parameter = as_type_ptr<op::Parameter>(read_node());
+            NGRAPH_CHECK(parameter, "Invalid parameter in binary function");
+        }
+        NGRAPH_CHECK(graph.at_end(), "Unexpected data after nodes in binary function");
+        return make_shared<Function>(results, parameters, name);
+    }
+}
+
+void ngraph::serialize_binary(ostream& out, const shared_ptr<Function>& func)
+{
+    auto ops = func->get_ordered_ops();
+    unordered_map<const Node*, uint64_t> node_ids;
+    node_ids.reserve(ops.size());
+    for (size_t i = 0; i < ops.size(); ++i)
+    {
+        node_ids.emplace(ops[i].get(), i);
+    }
+    auto write_node = [&](Writer& writer, const Node* node) {
+        auto it = node_ids.find(node);
+        NGRAPH_CHECK(it != node_ids.end(), "Node ", *node, " is not a part of the function");
+        writer.write<uint64_t>(it->second);
+    };
+
+    struct ConstantData
+    {
+        const void* data;
+        uint64_t offset;
+        uint64_t size;
+    };
+    vector<ConstantData> constants;
+    uint64_t data_size = 0;
+
+    Writer graph;
+    AttributeWriter attribute_writer(graph, node_ids);
+    graph.write_string(func->get_friendly_name());
+    graph.write<uint64_t>(ops.size());
+    for (auto& node : ops)
+    {
+        auto& type_info = node->get_type_info();
+        graph.write_string(type_info.name);
+        graph.write<uint64_t>(type_info.version);
+        graph.write_string(node->get_friendly_name());
+
+        graph.write<uint32_t>(node->get_input_size());
+        for (auto& input : node->inputs())
+        {
+            auto source = input.get_source_output();
+            write_node(graph, source.get_node());
+            graph.write<uint32_t>(source.get_index());
+        }
+        auto& control_dependencies = node->get_control_dependencies();
+        graph.write<uint32_t>(control_dependencies.size());
+        for (auto& dependency : control_dependencies)
+        {
+            write_node(graph, dependency.get());
+        }
+
+        if (auto constant = as_type_ptr<op::Constant>(node))
+        {
+            // The data goes to the aligned data section and is referred to by offset
+            auto element_type = constant->get_element_type();
+            auto& shape = constant->get_shape();
+            graph.write_string(AttributeAdapter<element::Type>(element_type).get());
+            graph.write_vector(vector<uint64_t>(shape.begin(), shape.end()));
+            ConstantData constant_data;
+            constant_data.data = constant->get_data_ptr();
+            constant_data.offset = align(data_size);
+            constant_data.size = (shape_size(shape) * element_type.bitwidth() + 7) / 8;
+            graph.write<uint64_t>(constant_data.offset);
+            graph.write<uint64_t>(constant_data.size);
+            constants.push_back(constant_data);
+            data_size = constant_data.offset + constant_data.size;
+        }
+        else
+        {
+            attribute_writer.write_attributes(*node);
+        }
+    }
+
+    graph.write<uint32_t>(func->get_results().size());
+    for (auto& result : func->get_results())
+    {
+        write_node(graph, result.get());
+    }
+    graph.write<uint32_t>(func->get_parameters().size());
+    for (auto& parameter : func->get_parameters())
+    {
+        write_node(graph, parameter.get());
+    }
+
+    Header header{};
+    memcpy(header.magic, binary_format_magic, sizeof(binary_format_magic));
+    header.version = binary_format_version;
+    header.byte_order = byte_order_mark;
+    header.graph_offset = sizeof(Header);
+    header.graph_size = graph.size();
+    header.data_offset = align(header.graph_offset + header.graph_size);
+    header.data_size = data_size;
+
+    static const char padding[data_alignment] = {};
+    out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    out.write(graph.data(), graph.size());
+    out.write(padding, header.data_offset - header.graph_offset - header.graph_size);
+    uint64_t position = 0;
+    for (auto& constant : constants)
+    {
+        out.write(padding, constant.offset - position);
+        out.write(static_cast<const char*>(constant.data), constant.size);
+        position = constant.offset + constant.size;
+    }
+    NGRAPH_CHECK(out.good(), "Failed to write binary function");
+}
+
+void ngraph::serialize_binary(const string& path, const shared_ptr<Function>& func)
+{
+    ofstream out(path, ios::binary);
+    NGRAPH_CHECK(out.is_open(), "Cannot open ", path);
+    serialize_binary(out, func);
+}
+
+shared_ptr<Function> ngraph::deserialize_binary(istream& in)
+{
+    // The header tells the size of the rest, so the data is read once into an aligned buffer
+    Header header;
+    in.read(reinterpret_cast<char*>(&header), sizeof(Header));
+    NGRAPH_CHECK(in.gcount() == sizeof(Header), "Binary function is truncated");
+    check_header(header);
+
+    size_t size = header.data_offset + header.data_size;
+    auto buffer = make_shared<runtime::AlignedBuffer>(size, data_alignment);
+    memcpy(buffer->get_ptr(), &header, sizeof(Header));
+    in.read(buffer->get_ptr<char>() + sizeof(Header), size - sizeof(Header));
+    NGRAPH_CHECK(static_cast<size_t>(in.gcount()) == size - sizeof(Header),
+                 "Binary function is truncated");
+    return read_function(buffer->get_ptr<char>(), size, buffer);
+}
+
+shared_ptr<Function> ngraph::deserialize_binary(const string& path)
+{
+    auto file = make_shared<MappedFile>(path);
+    return read_function(file->data(), file->size(), file);
+}
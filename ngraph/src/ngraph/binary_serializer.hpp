@@ -0,0 +1,66 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "ngraph/function.hpp"
+
+namespace ngraph
+{
+    /// \brief Version of the binary format written by serialize_binary
+    ///
+    /// Files of other versions are rejected by deserialize_binary.
+    constexpr uint32_t binary_format_version = 1;
+
+    /// \brief Serialize a Function to a stream in the binary format
+    ///
+    /// The format has a fixed header, a section with the nodes in topological order and their
+    /// attributes (as reported by visit_attributes), and a section with the Constant data, where
+    /// every tensor is aligned to 64 bytes so that it can be used in place once the file is
+    /// mapped into memory. Numbers are stored in the host byte order. Runtime info and nodes
+    /// without attribute visiting support are not serialized.
+    ///
+    /// \param out The output stream, opened in binary mode
+    /// \param func The Function to serialize
+    NGRAPH_API
+    void serialize_binary(std::ostream& out, const std::shared_ptr<Function>& func);
+
+    /// \brief Serialize a Function to a file in the binary format
+    /// \param path The path to the output file
+    /// \param func The Function to serialize
+    NGRAPH_API
+    void serialize_binary(const std::string& path, const std::shared_ptr<Function>& func);
+
+    /// \brief Deserialize a Function written by serialize_binary from a stream
+    ///
+    /// The whole stream is read into memory which is then shared by the Constant nodes.
+    /// \param in The input stream, opened in binary mode
+    NGRAPH_API
+    std::shared_ptr<Function> deserialize_binary(std::istream& in);
+
+    /// \brief Deserialize a Function written by serialize_binary from a file
+    ///
+    /// The file is mapped into memory and the Constant nodes refer to their data in the mapping
+    /// without copying it, so the data is only read from the disk when it is used.
+    /// \param path The path to the file
+    NGRAPH_API
+    std::shared_ptr<Function> deserialize_binary(const std::string& path);
+}
@@ -32,6 +32,7 @@ descriptor::Input::Input(Node* node, size_t index, Output& output)
 {
     m_src_node = std::shared_ptr<Node>(output.get_node());
     output.add_input(this);
+    m_node->on_inputs_changed();
 }
 
 descriptor::Input::Input(Node* node, size_t index)
@@ -57,6 +58,7 @@ void descriptor::Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    m_node->on_inputs_changed();
 
     if (getenv_bool("NGRAPH_ENABLE_REPLACE_CHECK"))
     {
@@ -79,6 +81,7 @@ void descriptor::Input::remove_output()
         m_output->remove_input(this);
         m_src_node = nullptr;
         m_output = nullptr;
+        m_node->on_inputs_changed();
     }
 }
 
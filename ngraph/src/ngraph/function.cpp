@@ -17,11 +17,13 @@
 #include <algorithm>
 #include <list>
 #include <memory>
+#include <unordered_set>
 
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/itt.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/tensor_iterator.hpp"
 #include "ngraph/op/util/op_types.hpp"
 #include "ngraph/util.hpp"
 
@@ -90,21 +92,128 @@ void Function::validate_nodes_and_infer_types()
     }
 }
 
+void Function::validate_changed_nodes_and_infer_types()
+{
+    OV_ITT_SCOPED_TASK(itt::domains::Ngraph, "Function::validate_changed_nodes_and_infer_types");
+
+    // Nodes whose output values may differ from the ones at their last validation
+    std::unordered_set<Node*> changed_values;
+    for (auto& node : get_ordered_ops())
+    {
+        // A node is marked when its inputs are replaced or the type of one of them changes, so
+        // a changed type propagates further only as far as it changes the types of consumers
+        bool revalidate = node->inputs_changed() || op::is_parameter(node) ||
+                          is_type<op::v0::TensorIterator>(node);
+        bool values_changed = node->inputs_changed();
+        for (size_t i = 0; i < node->get_input_size(); ++i)
+        {
+            const auto input = node->input(i);
+            if (changed_values.count(input.get_source_output().get_node()) == 0)
+            {
+                continue;
+            }
+            values_changed = values_changed || input.get_is_relevant_to_values();
+            // The output types depend on the values of the inputs relevant to the shapes
+            revalidate = revalidate || input.get_is_relevant_to_shapes();
+        }
+
+        if (revalidate)
+        {
+            node->revalidate_and_infer_types();
+        }
+        if (values_changed)
+        {
+            changed_values.insert(node.get());
+        }
+
+        // If we find a parameter make sure it is in the list of parameters of the function
+        if (op::is_parameter(node))
+        {
+            auto it = std::find(m_parameters.begin(), m_parameters.end(), node);
+            if (it == m_parameters.end())
+            {
+                throw ngraph_error("Function references undeclared parameter");
+            }
+        }
+    }
+}
+
+bool Function::is_ordered_ops_cache_valid() const
+{
+    if (!m_ordered_ops_cached || m_cached_topology_version != *m_topology_version ||
+        m_cached_roots.size() != m_results.size() + m_parameters.size())
+    {
+        return false;
+    }
+    // Results and parameters can be replaced without any change of the nodes inputs
+    auto root = m_cached_roots.begin();
+    for (auto& r : m_results)
+    {
+        if ((root++)->lock() != r)
+        {
+            return false;
+        }
+    }
+    for (auto& param : m_parameters)
+    {
+        if ((root++)->lock() != param)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Function::invalidate_ordered_ops_cache()
+{
+    std::lock_guard<std::mutex> lock(m_ordered_ops_mutex);
+    m_ordered_ops_cached = false;
+    m_cached_ordered_ops.clear();
+}
+
 std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
     OV_ITT_SCOPED_TASK(itt::domains::Ngraph, "Function::get_ordered_ops");
 
+    std::lock_guard<std::mutex> lock(m_ordered_ops_mutex);
+    vector<shared_ptr<Node>> ordered_ops;
+    if (is_ordered_ops_cache_valid())
+    {
+        ordered_ops.reserve(m_cached_ordered_ops.size());
+        for (Node* node : m_cached_ordered_ops)
+        {
+            ordered_ops.push_back(node->shared_from_this());
+        }
+        return ordered_ops;
+    }
+
+    // The version is read before sorting, a concurrent change of the graph only makes the
+    // cache stale
+    size_t topology_version = *m_topology_version;
     vector<shared_ptr<Node>> nodes;
+    m_cached_roots.clear();
     for (auto& r : get_results())
     {
         nodes.push_back(r);
+        m_cached_roots.push_back(r);
     }
     for (auto& param : get_parameters())
     {
         nodes.push_back(param);
+        m_cached_roots.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    ordered_ops = m_topological_sorter(nodes);
+    m_cached_ordered_ops.clear();
+    m_cached_ordered_ops.reserve(ordered_ops.size());
+    for (auto& node : ordered_ops)
+    {
+        node->add_topology_version(m_topology_version);
+        m_cached_ordered_ops.push_back(node.get());
+    }
+    m_cached_topology_version = topology_version;
+    m_ordered_ops_cached = true;
+    return ordered_ops;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -275,4 +384,5 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    invalidate_ordered_ops_cache();
 }
@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -99,6 +100,12 @@ namespace ngraph
 
         void validate_nodes_and_infer_types();
 
+        /// \brief Validates and infers types of the nodes whose inputs or input types were
+        ///        changed after their last validation, the other nodes are skipped. Parameters
+        ///        and nodes with sub-graphs are always validated. A node is validated also when
+        ///        the values of its inputs relevant to the shapes may have changed.
+        void validate_changed_nodes_and_infer_types();
+
         /// \brief Returns the sum of the size of all nodes in the graph plus the size of
         /// all constant data. This has little value beyond comparing the relative size of
         /// graphs and should not be considered the actual memory consumption of a graph.
@@ -126,10 +133,26 @@ namespace ngraph
         Function(const Function&&) = delete;
         Function& operator=(const Function&) = delete;
 
+        /// \brief Returns true if the cached order of the ops is still valid
+        bool is_ordered_ops_cache_valid() const;
+        void invalidate_ordered_ops_cache();
+
         static std::atomic<size_t> m_next_instance_id;
         std::string m_name;
         const std::string m_unique_name;
         size_t m_placement{0};
         topological_sort_t m_topological_sorter;
+
+        // The order of the ops is cached until the topology of the graph changes
+        mutable std::mutex m_ordered_ops_mutex;
+        mutable std::vector<Node*> m_cached_ordered_ops;
+        // Results and parameters the order was cached for, a new node can get the address of
+        // a destroyed one
+        mutable std::vector<std::weak_ptr<Node>> m_cached_roots;
+        // Incremented by the nodes of the cached order when their inputs change
+        std::shared_ptr<std::atomic<size_t>> m_topology_version{
+            std::make_shared<std::atomic<size_t>>(0)};
+        mutable size_t m_cached_topology_version{0};
+        mutable bool m_ordered_ops_cached{false};
     };
 }
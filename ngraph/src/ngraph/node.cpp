@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <typeindex>
 #include <typeinfo>
@@ -198,6 +199,42 @@ descriptor::Output& Node::get_output_descriptor(size_t position)
     return m_outputs.at(position);
 }
 
+void Node::on_inputs_changed()
+{
+    m_inputs_changed = true;
+    on_topology_changed();
+}
+
+void Node::on_topology_changed()
+{
+    for (auto& topology_version : m_topology_versions)
+    {
+        if (auto version = topology_version.lock())
+        {
+            ++*version;
+        }
+    }
+}
+
+void Node::add_topology_version(const shared_ptr<atomic<size_t>>& topology_version)
+{
+    // The counters of the destroyed functions are dropped
+    m_topology_versions.erase(remove_if(m_topology_versions.begin(),
+                                        m_topology_versions.end(),
+                                        [](const weak_ptr<atomic<size_t>>& version) {
+                                            return version.expired();
+                                        }),
+                              m_topology_versions.end());
+    for (auto& version : m_topology_versions)
+    {
+        if (version.lock() == topology_version)
+        {
+            return;
+        }
+    }
+    m_topology_versions.push_back(topology_version);
+}
+
 void Node::set_argument(size_t position, const Output<Node>& argument)
 {
     auto output_node = argument.get_node();
@@ -259,15 +296,42 @@ void Node::set_input_is_relevant_to_value(size_t i, bool relevant)
 
 void Node::set_output_type(size_t i, const element::Type& element_type, const PartialShape& pshape)
 {
-    get_output_descriptor(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
+    auto& output = get_output_descriptor(i);
+    auto& tensor = output.get_tensor();
+    if (tensor.get_element_type() != element_type || tensor.get_partial_shape() != pshape)
+    {
+        // Consumers of the output have to infer their types again
+        for (descriptor::Input* input : output.get_inputs())
+        {
+            input->get_raw_pointer_node()->m_inputs_changed = true;
+        }
+    }
+    tensor.set_tensor_type(element_type, pshape);
+}
+
+namespace
+{
+    // Type names are shared by all nodes of a type instead of being copied into every node
+    const std::string& intern_type_name(const char* type_name)
+    {
+        static std::mutex mutex;
+        static std::unordered_set<std::string> type_names;
+        std::lock_guard<std::mutex> lock(mutex);
+        return *type_names.insert(type_name).first;
+    }
 }
 
 const std::string& Node::description() const
 {
     // Terrible transitional kludge to keep description working while we change
     // type_name to const_char and virtual description() to virtual get_type_name()
-    const_cast<Node*>(this)->m_node_type = get_type_name();
-    return m_node_type;
+    const char* type_name = get_type_name();
+    if (m_node_type == nullptr || m_node_type_name != type_name)
+    {
+        const_cast<Node*>(this)->m_node_type = &intern_type_name(type_name);
+        const_cast<Node*>(this)->m_node_type_name = type_name;
+    }
+    return *m_node_type;
 }
 
 const std::string& Node::get_friendly_name() const
@@ -472,6 +536,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
         m_control_dependencies.end())
     {
         m_control_dependencies.push_back(node);
+        on_topology_changed();
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
         {
@@ -509,6 +574,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         if (it != m_control_dependencies.end())
         {
             m_control_dependencies.erase(it);
+            on_topology_changed();
         }
     }
     {
@@ -531,6 +597,7 @@ void Node::clear_control_dependencies()
         }
     }
     m_control_dependencies.clear();
+    on_topology_changed();
 }
 
 void Node::clear_control_dependents()
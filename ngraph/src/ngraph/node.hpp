@@ -42,6 +42,7 @@
 #include "ngraph/op/util/attr_types.hpp"
 #include "ngraph/op/util/op_annotations.hpp"
 #include "ngraph/output_vector.hpp"
+#include "ngraph/stable_vector.hpp"
 #include "ngraph/strides.hpp"
 #include "ngraph/type.hpp"
 
@@ -226,7 +227,17 @@ namespace ngraph
         /// Sets the number of outputs
         void set_output_size(size_t output_size);
 
-        void revalidate_and_infer_types() { validate_and_infer_types(); }
+        void revalidate_and_infer_types()
+        {
+            validate_and_infer_types();
+            m_inputs_changed = false;
+        }
+        /// \brief Returns true if the inputs of the node were changed after its last revalidation
+        bool inputs_changed() const { return m_inputs_changed; }
+        /// \brief Makes any change of the node inputs or control dependencies increment the
+        ///        counter. A function registers its counter in every node of the cached order
+        ///        of its ops, so the order stays valid while the counter stays the same.
+        void add_topology_version(const std::shared_ptr<std::atomic<size_t>>& topology_version);
         // Called after transition
         void delayed_validate_and_infer_types();
 
@@ -468,18 +479,29 @@ namespace ngraph
     private:
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
+        /// \brief Marks the node for revalidation and changes the topology versions
+        void on_inputs_changed();
+        /// \brief Increments the topology versions of the functions the node belongs to
+        void on_topology_changed();
 
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
-        std::string m_node_type;
+        // Type name shared by all nodes of the type, and the name it was looked up for
+        const std::string* m_node_type{nullptr};
+        const char* m_node_type_name{nullptr};
         size_t m_instance_id{m_next_instance_id.fetch_add(1)};
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
         std::unordered_set<std::string> m_provenance_tags;
         std::set<std::shared_ptr<Node>> m_provenance_group;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
+        // Declared before m_inputs, the inputs update them when they are destroyed
+        bool m_inputs_changed{true};
+        std::vector<std::weak_ptr<std::atomic<size_t>>> m_topology_versions;
+        // Inputs and outputs are referenced by pointers from other nodes, so they must not move.
+        // Most of nodes fit in the in-place storage and need no allocations for them.
+        StableVector<descriptor::Input, 2> m_inputs;
+        StableVector<descriptor::Output, 1> m_outputs;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
         std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
     };
@@ -316,6 +316,26 @@ op::Constant::Constant(const element::Type& type, const Shape& shape, const void
     m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
 }
 
+op::Constant::Constant(const element::Type& type,
+                       const Shape& shape,
+                       const shared_ptr<runtime::AlignedBuffer>& data)
+    : m_element_type(type)
+    , m_shape(shape)
+    , m_data(data)
+{
+    size_t size = (shape_size(m_shape) * m_element_type.bitwidth() + 7) / 8;
+    NODE_VALIDATION_CHECK(this,
+                          m_data && m_data->size() >= size,
+                          "Constant buffer is smaller than the ",
+                          size,
+                          " bytes required by the shape ",
+                          m_shape,
+                          " of ",
+                          m_element_type);
+    constructor_validate_and_infer_types();
+    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+}
+
 op::Constant::Constant(const Constant& other)
     : Constant(other.m_element_type, other.m_shape)
 {
@@ -39,6 +39,7 @@ namespace ngraph
                     constructor_validate_and_infer_types();
                 }
 
+                bool visit_attributes(AttributeVisitor& visitor) override { return true; }
                 void validate_and_infer_types() override;
                 virtual std::shared_ptr<Node>
                     clone_with_new_inputs(const OutputVector& new_args) const override;
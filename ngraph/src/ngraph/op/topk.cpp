@@ -481,6 +481,8 @@ void op::v1::TopK::validate_and_infer_types()
     const auto& k_partial_shape = get_input_partial_shape(1);
     NODE_VALIDATION_CHECK(
         this, k_partial_shape.rank().compatible(0), "The 'K' input must be a scalar.");
+    // the maximum value of k limits the output shape
+    set_input_is_relevant_to_shape(1);
 
     size_t k = 0;
     if (op::is_constant(input_value(1).get_node()))
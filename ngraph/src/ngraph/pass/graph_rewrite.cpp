@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <deque>
+#include <iomanip>
 #include <iostream>
 #include <pattern/op/wrap_type.hpp>
 #include <regex>
@@ -26,6 +27,10 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/itt.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/pattern/op/any_output.hpp"
+#include "ngraph/pattern/op/label.hpp"
+#include "ngraph/pattern/op/or.hpp"
+#include "ngraph/pattern/op/true.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -61,11 +66,59 @@ using namespace ngraph;
 // GraphRewrite will automatically add this nodes in the beginning of execution queue.
 // If MatcherPass register more than one node make sure that this nodes are registered in
 // topological order.
+//
+// To avoid trying every MatcherPass on every node the passes are indexed by the types of nodes
+// their pattern root can match. Passes whose root can match any node (pattern::op::Any, Label
+// without wrapped nodes, etc.) are merged into the list of every type, so the passes are still
+// tried in the order of registration.
+
+namespace
+{
+    // Collects the node types the pattern value can match, returns false if it can match a node
+    // of any type
+    bool collect_root_types(const Output<Node>& pattern_value, std::vector<NodeTypeInfo>& types)
+    {
+        auto root = pattern_value.get_node_shared_ptr();
+        // pattern::op::AnyOutput operation automatically appends for multi output operations
+        // inside Matcher and to get actual root node we need to take it's parent.
+        if (dynamic_pointer_cast<pattern::op::AnyOutput>(root))
+        {
+            return collect_root_types(root->input_value(0), types);
+        }
+        if (auto wrap_type = dynamic_pointer_cast<pattern::op::WrapType>(root))
+        {
+            types.push_back(wrap_type->get_wrapped_type());
+            return true;
+        }
+        // Label matches the nodes it wraps, Or matches any of its inputs
+        if ((dynamic_pointer_cast<pattern::op::Label>(root) &&
+             !dynamic_cast<pattern::op::True*>(root->get_input_node_ptr(0))) ||
+            dynamic_pointer_cast<pattern::op::Or>(root))
+        {
+            for (auto& input_value : root->input_values())
+            {
+                if (!collect_root_types(input_value, types))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        if (dynamic_pointer_cast<pattern::op::Pattern>(root))
+        {
+            return false;
+        }
+        types.push_back(root->get_type_info());
+        return true;
+    }
+}
 
 bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 {
     OV_ITT_SCOPED_TASK(itt::domains::Ngraph, "pass::GraphRewrite::run_on_function");
 
+    static bool profile_enabled = getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
+
     bool rewritten = false;
 
     // Initialize execution queue with nodes in topological order
@@ -75,51 +128,48 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         nodes_to_run.emplace_back(node);
     }
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
-    std::unordered_map<NodeTypeInfo, std::vector<std::shared_ptr<MatcherPass>>> type_to_matcher;
-    for (auto& m : m_matchers)
+    // Index MatcherPasses by the types of their root nodes
+    std::vector<size_t> any_type_matchers;
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matchers;
+    for (size_t i = 0; i < m_matchers.size(); i++)
     {
-        auto matcher = m->get_matcher();
-        if (!matcher)
-        {
-            all_roots_has_type = false;
-            break;
-        }
-
-        auto root = matcher->get_pattern_value().get_node_shared_ptr();
-        // pattern::op::AnyOutput operation automatically appends for multi output operations inside
-        // Matcher and to gen actual root node we need to take it's parent.
-        if (auto any_type = dynamic_pointer_cast<pattern::op::AnyOutput>(root))
+        auto matcher = m_matchers[i]->get_matcher();
+        std::vector<NodeTypeInfo> root_types;
+        if (!matcher || !collect_root_types(matcher->get_pattern_value(), root_types))
         {
-            root = any_type->input_value(0).get_node_shared_ptr();
+            any_type_matchers.push_back(i);
+            continue;
         }
-
-        // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
-        NodeTypeInfo root_type_info = root->get_type_info();
-        if (auto p = dynamic_pointer_cast<pattern::op::Pattern>(root))
+        for (auto& root_type : root_types)
         {
-            if (auto any_type = dynamic_pointer_cast<pattern::op::WrapType>(p))
+            auto& matchers = type_to_matchers[root_type];
+            if (matchers.empty() || matchers.back() != i)
             {
-                root_type_info = any_type->get_wrapped_type();
-            }
-            else
-            {
-                all_roots_has_type = false;
-                break;
+                matchers.push_back(i);
             }
         }
-        type_to_matcher[root_type_info].push_back(m);
     }
+    if (!any_type_matchers.empty())
+    {
+        for (auto& type_matchers : type_to_matchers)
+        {
+            std::vector<size_t> merged;
+            merged.reserve(type_matchers.second.size() + any_type_matchers.size());
+            std::merge(type_matchers.second.begin(),
+                       type_matchers.second.end(),
+                       any_type_matchers.begin(),
+                       any_type_matchers.end(),
+                       std::back_inserter(merged));
+            type_matchers.second = std::move(merged);
+        }
+    }
+    m_matcher_statistics.resize(m_matchers.size());
 
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
-    auto run_matcher_pass = [&](std::shared_ptr<MatcherPass> m_pass,
-                                std::shared_ptr<Node> node) -> bool {
+    auto run_matcher_pass = [&](size_t index, std::shared_ptr<Node> node) -> bool {
+        auto& m_pass = m_matchers[index];
         // Keep this property check for backward compatibility. In future transformation property
         // will be deprecated and removed.
         if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && f->is_dynamic())
@@ -138,7 +188,23 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
-        bool status = m_pass->apply(node);
+        auto& statistics = m_matcher_statistics[index];
+        statistics.attempts++;
+        bool status;
+        if (profile_enabled)
+        {
+            auto start = std::chrono::steady_clock::now();
+            status = m_pass->apply(node);
+            statistics.time += std::chrono::steady_clock::now() - start;
+        }
+        else
+        {
+            status = m_pass->apply(node);
+        }
+        if (status)
+        {
+            statistics.hits++;
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -165,39 +231,49 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type)
+        auto it = type_to_matchers.find(node->get_type_info());
+        const auto& matchers = it != type_to_matchers.end() ? it->second : any_type_matchers;
+        for (size_t index : matchers)
         {
-            auto node_type_info = node->get_type_info();
-            if (type_to_matcher.count(node_type_info))
+            if (run_matcher_pass(index, node))
             {
-                for (auto& m_pass : type_to_matcher[node_type_info])
-                {
-                    if (run_matcher_pass(m_pass, node))
-                    {
-                        rewritten = true;
-                        break;
-                    }
-                }
+                rewritten = true;
+                break;
             }
         }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else
+    }
+
+    if (profile_enabled)
+    {
+        for (size_t i = 0; i < m_matchers.size(); i++)
         {
-            for (auto& m_pass : m_matchers)
+            const auto& statistics = m_matcher_statistics[i];
+            if (statistics.attempts)
             {
-                if (run_matcher_pass(m_pass, node))
-                {
-                    rewritten = true;
-                    break;
-                }
+                cout << setw(7)
+                     << std::chrono::duration_cast<std::chrono::milliseconds>(statistics.time)
+                            .count()
+                     << "ms " << statistics.hits << "/" << statistics.attempts << " "
+                     << m_matchers[i]->get_name() << "\n";
             }
         }
     }
     return rewritten;
 }
 
+std::vector<std::pair<std::string, pass::GraphRewrite::MatcherStatistics>>
+    pass::GraphRewrite::get_matcher_statistics() const
+{
+    std::vector<std::pair<std::string, MatcherStatistics>> statistics;
+    for (size_t i = 0; i < m_matchers.size(); i++)
+    {
+        statistics.emplace_back(m_matchers[i]->get_name(),
+                                i < m_matcher_statistics.size() ? m_matcher_statistics[i]
+                                                                : MatcherStatistics());
+    }
+    return statistics;
+}
+
 void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
                                      const graph_rewrite_callback& callback,
                                      const PassPropertyMask& property)
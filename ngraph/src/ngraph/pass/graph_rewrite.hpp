@@ -16,9 +16,13 @@
 
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <set>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pattern/matcher.hpp"
@@ -103,10 +107,11 @@ private:
 ///
 /// Graph rewrite pass is used for matcher passes execution on Function.
 /// To register MatcherPass use \sa add_matcher<T>(args) method where T is a MatcherPass class.
-/// As a default algorithm graph rewrite pass traverse Function in topological order and applies
-/// registered matcher passes for each node. But if all registered matcher passes have type based
-/// root node in Matcher pattern then efficient mechanism is used to execute them.
-/// Matcher pattern root is type based if it's operation from opset or pattern::op::WrapType.
+/// Graph rewrite pass traverses Function in topological order and applies registered matcher
+/// passes for each node. Matcher passes are indexed by the types their pattern root can match, so
+/// only the passes that can match a node are tried, in the order of registration.
+/// Matcher pattern root is type based if it's operation from opset or pattern::op::WrapType, or a
+/// Label or pattern::op::Or wrapping type based nodes only. Other roots are tried on every node.
 /// Note: when implementing pattern for Matcher make sure that root node is an operation from opset
 /// or has ngraph::pattern::op::WrapType. That will help GraphRewrite to execute matcher passes more
 /// efficient.
@@ -142,10 +147,28 @@ public:
 
     bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
+    /// \brief Statistics of a registered MatcherPass over all runs of the GraphRewrite
+    struct MatcherStatistics
+    {
+        /// Number of nodes the pass was applied to
+        size_t attempts = 0;
+        /// Number of nodes the pass has rewritten
+        size_t hits = 0;
+        /// Time spent in the pass, measured only if NGRAPH_PROFILE_PASS_ENABLE is set
+        std::chrono::nanoseconds time{0};
+    };
+
+    /// \brief Returns the names of registered matcher passes with their statistics in the order
+    /// of registration
+    std::vector<std::pair<std::string, MatcherStatistics>> get_matcher_statistics() const;
+
 protected:
     bool m_enable_shape_inference = false;
 
     std::vector<std::shared_ptr<ngraph::pass::MatcherPass>> m_matchers;
+
+private:
+    std::vector<MatcherStatistics> m_matcher_statistics;
 };
 
 class NGRAPH_API ngraph::pass::RecurrentGraphRewrite : public ngraph::pass::FunctionPass
@@ -22,6 +22,6 @@ using namespace ngraph;
 
 bool pass::Validate::run_on_function(std::shared_ptr<Function> f)
 {
-    f->validate_nodes_and_infer_types();
+    f->validate_changed_nodes_and_infer_types();
     return false;
 }
@@ -0,0 +1,150 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ngraph
+{
+    /// \brief Sequence container whose elements never move once constructed.
+    ///
+    /// The first N elements are stored in place, the following ones in separately allocated
+    /// blocks of BlockSize elements, so appending an element does not invalidate pointers to
+    /// the others. Used for node inputs and outputs, which are referenced by pointers from other
+    /// nodes, without the allocations std::deque does for every (even empty) instance.
+    template <typename T, size_t N, size_t BlockSize = 8>
+    class StableVector
+    {
+        using Storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+        template <typename Container, typename Value>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Value*;
+            using reference = Value&;
+
+            Iterator(Container* container, size_t index)
+                : m_container(container)
+                , m_index(index)
+            {
+            }
+            reference operator*() const { return (*m_container)[m_index]; }
+            pointer operator->() const { return &(*m_container)[m_index]; }
+            Iterator& operator++()
+            {
+                ++m_index;
+                return *this;
+            }
+            Iterator operator++(int)
+            {
+                Iterator it = *this;
+                ++m_index;
+                return it;
+            }
+            bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+            bool operator!=(const Iterator& other) const { return m_index != other.m_index; }
+        private:
+            Container* m_container;
+            size_t m_index;
+        };
+
+    public:
+        using iterator = Iterator<StableVector, T>;
+        using const_iterator = Iterator<const StableVector, const T>;
+
+        StableVector() = default;
+        StableVector(const StableVector&) = delete;
+        StableVector& operator=(const StableVector&) = delete;
+        ~StableVector() { clear(); }
+        template <typename... Args>
+        T& emplace_back(Args&&... args)
+        {
+            if (m_size >= N && (m_size - N) / BlockSize >= m_blocks.size())
+            {
+                m_blocks.emplace_back(new Storage[BlockSize]);
+            }
+            T* element = reinterpret_cast<T*>(storage(m_size));
+            new (element) T(std::forward<Args>(args)...);
+            ++m_size;
+            return *element;
+        }
+
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        T& operator[](size_t i) { return *reinterpret_cast<T*>(storage(i)); }
+        const T& operator[](size_t i) const
+        {
+            return *reinterpret_cast<const T*>(const_cast<StableVector*>(this)->storage(i));
+        }
+
+        T& at(size_t i)
+        {
+            check_range(i);
+            return (*this)[i];
+        }
+        const T& at(size_t i) const
+        {
+            check_range(i);
+            return (*this)[i];
+        }
+
+        T& back() { return (*this)[m_size - 1]; }
+        const T& back() const { return (*this)[m_size - 1]; }
+        iterator begin() { return iterator(this, 0); }
+        iterator end() { return iterator(this, m_size); }
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, m_size); }
+        void clear()
+        {
+            for (size_t i = 0; i < m_size; ++i)
+            {
+                (*this)[i].~T();
+            }
+            m_size = 0;
+            m_blocks.clear();
+        }
+
+    private:
+        Storage* storage(size_t i)
+        {
+            return i < N ? &m_inplace[i] : &m_blocks[(i - N) / BlockSize][(i - N) % BlockSize];
+        }
+
+        void check_range(size_t i) const
+        {
+            if (i >= m_size)
+            {
+                throw std::out_of_range("StableVector index out of range");
+            }
+        }
+
+        Storage m_inplace[N];
+        std::vector<std::unique_ptr<Storage[]>> m_blocks;
+        size_t m_size{0};
+    };
+}
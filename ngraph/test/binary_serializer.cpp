@@ -0,0 +1,235 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <fstream>
+#include <numeric>
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/binary_serializer.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/opsets/opset3.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static shared_ptr<Function> make_test_function()
+{
+    auto data = make_shared<opset3::Parameter>(element::f32, Shape{1, 3, 8, 8});
+    vector<float> weights_values(4 * 3 * 3 * 3);
+    for (size_t i = 0; i < weights_values.size(); i++)
+    {
+        weights_values[i] = static_cast<float>(i) / 10;
+    }
+    auto weights = make_shared<opset3::Constant>(element::f32, Shape{4, 3, 3, 3}, weights_values);
+    auto conv = make_shared<opset3::Convolution>(data,
+                                                 weights,
+                                                 Strides{2, 2},
+                                                 CoordinateDiff{1, 1},
+                                                 CoordinateDiff{0, 1},
+                                                 Strides{1, 1},
+                                                 op::PadType::EXPLICIT);
+    auto bias = make_shared<opset3::Constant>(
+        element::f32, Shape{1, 4, 1, 1}, vector<float>{1.f, 2.f, 3.f, 4.f});
+    auto add = make_shared<opset3::Add>(conv, bias);
+    add->set_friendly_name("biased");
+    auto k = make_shared<opset3::Constant>(element::i64, Shape{}, vector<int64_t>{2});
+    auto topk = make_shared<opset3::TopK>(add,
+                                          k,
+                                          1,
+                                          op::v1::TopK::Mode::MIN,
+                                          op::v1::TopK::SortType::SORT_INDICES,
+                                          element::i32);
+    auto values = make_shared<opset3::Result>(topk->output(0));
+    auto indices = make_shared<opset3::Result>(topk->output(1));
+    auto f = make_shared<Function>(ResultVector{values, indices}, ParameterVector{data}, "test");
+    return f;
+}
+
+static void check_same_functions(const shared_ptr<Function>& f, const shared_ptr<Function>& g)
+{
+    EXPECT_EQ(g->get_friendly_name(), f->get_friendly_name());
+    ASSERT_EQ(g->get_results().size(), f->get_results().size());
+    ASSERT_EQ(g->get_parameters().size(), f->get_parameters().size());
+    auto f_ops = f->get_ordered_ops();
+    auto g_ops = g->get_ordered_ops();
+    ASSERT_EQ(g_ops.size(), f_ops.size());
+    for (size_t i = 0; i < f_ops.size(); i++)
+    {
+        EXPECT_EQ(g_ops[i]->get_type_info(), f_ops[i]->get_type_info());
+        EXPECT_EQ(g_ops[i]->get_friendly_name(), f_ops[i]->get_friendly_name());
+        ASSERT_EQ(g_ops[i]->get_output_size(), f_ops[i]->get_output_size());
+        for (size_t j = 0; j < f_ops[i]->get_output_size(); j++)
+        {
+            EXPECT_EQ(g_ops[i]->get_output_element_type(j), f_ops[i]->get_output_element_type(j));
+            EXPECT_EQ(g_ops[i]->get_output_partial_shape(j),
+                      f_ops[i]->get_output_partial_shape(j));
+        }
+        if (auto f_constant = as_type_ptr<op::Constant>(f_ops[i]))
+        {
+            auto g_constant = as_type_ptr<op::Constant>(g_ops[i]);
+            ASSERT_TRUE(g_constant);
+            EXPECT_EQ(0,
+                      memcmp(g_constant->get_data_ptr(),
+                             f_constant->get_data_ptr(),
+                             shape_size(f_constant->get_shape()) *
+                                 f_constant->get_element_type().size()));
+        }
+    }
+}
+
+TEST(binary_serializer, round_trip)
+{
+    auto f = make_test_function();
+    stringstream stream;
+    serialize_binary(stream, f);
+    auto g = deserialize_binary(stream);
+    check_same_functions(f, g);
+
+    for (auto& node : g->get_ordered_ops())
+    {
+        if (auto conv = as_type_ptr<opset3::Convolution>(node))
+        {
+            EXPECT_EQ(conv->get_strides(), (Strides{2, 2}));
+            EXPECT_EQ(conv->get_pads_begin(), (CoordinateDiff{1, 1}));
+            EXPECT_EQ(conv->get_pads_end(), (CoordinateDiff{0, 1}));
+            EXPECT_EQ(conv->get_auto_pad(), op::PadType::EXPLICIT);
+        }
+        else if (auto topk = as_type_ptr<opset3::TopK>(node))
+        {
+            EXPECT_EQ(topk->get_provided_axis(), 1);
+            EXPECT_EQ(topk->get_mode(), op::v1::TopK::Mode::MIN);
+            EXPECT_EQ(topk->get_sort_type(), op::v1::TopK::SortType::SORT_INDICES);
+            EXPECT_EQ(topk->get_index_element_type(), element::i32);
+        }
+    }
+}
+
+TEST(binary_serializer, mapped_constants)
+{
+    const string tmp_file = "binary_serializer_mapped_constants.bin";
+    auto f = make_test_function();
+    serialize_binary(tmp_file, f);
+    auto g = deserialize_binary(tmp_file);
+    file_util::remove_file(tmp_file);
+    check_same_functions(f, g);
+
+    for (auto& node : g->get_ordered_ops())
+    {
+        if (auto constant = as_type_ptr<op::Constant>(node))
+        {
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(constant->get_data_ptr()) % 64, 0);
+        }
+    }
+}
+
+TEST(binary_serializer, rejects_malformed_data)
+{
+    stringstream stream;
+    serialize_binary(stream, make_test_function());
+    string data = stream.str();
+
+    string other_version = data;
+    other_version[8] = static_cast<char>(binary_format_version + 1);
+    stringstream other_version_stream(other_version);
+    EXPECT_THROW(deserialize_binary(other_version_stream), CheckFailure);
+
+    stringstream truncated_stream(data.substr(0, data.size() - 1));
+    EXPECT_THROW(deserialize_binary(truncated_stream), CheckFailure);
+}
+
+// Writes a file of about 75MB, run it with --gtest_also_run_disabled_tests
+TEST(benchmark, DISABLED_serialize_binary)
+{
+    // Weights dominate the size of real models
+    const size_t layers = 32;
+    const size_t channels = 256;
+    auto data = make_shared<opset3::Parameter>(element::f32, Shape{1, channels, 8, 8});
+    Output<Node> value = data;
+    for (size_t i = 0; i < layers; i++)
+    {
+        auto weights = make_shared<opset3::Constant>(
+            element::f32,
+            Shape{channels, channels, 3, 3},
+            vector<float>(channels * channels * 3 * 3, static_cast<float>(i)));
+        value = make_shared<opset3::Convolution>(value,
+                                                 weights,
+                                                 Strides{1, 1},
+                                                 CoordinateDiff{1, 1},
+                                                 CoordinateDiff{1, 1},
+                                                 Strides{1, 1});
+        value = make_shared<opset3::Relu>(value);
+    }
+    auto f = make_shared<Function>(OutputVector{value}, ParameterVector{data});
+
+    const string tmp_file = "benchmark_serialize_binary.bin";
+    stopwatch timer;
+    timer.start();
+    serialize_binary(tmp_file, f);
+    timer.stop();
+    NGRAPH_INFO << "serialize_binary       " << timer.get_milliseconds() << "ms";
+
+    // A plain read of the whole file is the reference for loading
+    timer.start();
+    {
+        ifstream in(tmp_file, ios::binary | ios::ate);
+        vector<char> buffer(in.tellg());
+        in.seekg(0);
+        in.read(buffer.data(), buffer.size());
+        NGRAPH_INFO << "file size              " << buffer.size() / (1024 * 1024) << "MB";
+    }
+    timer.stop();
+    NGRAPH_INFO << "read file              " << timer.get_milliseconds() << "ms";
+
+    // The file is mapped lazily, reading the weights makes the load comparable with the plain read
+    auto touch_constants = [](const shared_ptr<Function>& func) {
+        size_t sum = 0;
+        for (const auto& op : func->get_ops())
+        {
+            if (auto constant = as_type_ptr<op::Constant>(op))
+            {
+                auto data = static_cast<const uint8_t*>(constant->get_data_ptr());
+                sum = accumulate(
+                    data, data + shape_size(constant->get_shape()) *
+                                     constant->get_element_type().size(),
+                    sum);
+            }
+        }
+        return sum;
+    };
+
+    timer.start();
+    auto g = deserialize_binary(tmp_file);
+    size_t checksum = touch_constants(g);
+    timer.stop();
+    NGRAPH_INFO << "deserialize_binary     " << timer.get_milliseconds() << "ms";
+
+    timer.start();
+    {
+        ifstream in(tmp_file, ios::binary);
+        g = deserialize_binary(in);
+    }
+    EXPECT_EQ(touch_constants(g), checksum);
+    timer.stop();
+    NGRAPH_INFO << "deserialize_binary (stream) " << timer.get_milliseconds() << "ms";
+    file_util::remove_file(tmp_file);
+
+    EXPECT_EQ(g->get_ops().size(), f->get_ops().size());
+}
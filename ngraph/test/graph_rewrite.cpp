@@ -6,6 +6,7 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 #include <util/test_tools.hpp>
 
 using namespace ::testing;
@@ -117,3 +118,38 @@ TEST(GraphRewriteTest, ManagerCallback2)
 
     ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
 }
+
+class ParameterPass : public ngraph::pass::MatcherPass
+{
+public:
+    ParameterPass()
+        : MatcherPass()
+    {
+        auto parameter = pattern::wrap_type<opset3::Parameter>();
+        ngraph::graph_rewrite_callback callback = [](pattern::Matcher& /* m */) { return false; };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(parameter, "ParameterMatcher");
+        this->register_matcher(m, callback);
+    }
+};
+
+TEST(GraphRewriteTest, MatcherStatistics)
+{
+    auto f = get_function();
+    size_t ops_count = f->get_ordered_ops().size();
+
+    Anchor anchor;
+    anchor.add_matcher<ParameterPass>();
+    anchor.add_matcher<TestPass>();
+    anchor.set_callback(get_callback());
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
+    auto statistics = anchor.get_matcher_statistics();
+    ASSERT_EQ(statistics.size(), 2);
+    // type based root is tried on the parameter only, label root on every node
+    EXPECT_EQ(statistics[0].second.attempts, 1);
+    EXPECT_EQ(statistics[0].second.hits, 0);
+    EXPECT_EQ(statistics[1].second.attempts, ops_count);
+    EXPECT_EQ(statistics[1].second.hits, 1);
+}
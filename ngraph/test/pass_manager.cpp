@@ -53,4 +53,177 @@ namespace
         }
         bool run_on_function(std::shared_ptr<ngraph::Function> /* f */) override { return false; }
     };
+
+    // Passes the input through and counts its validations
+    class CountingIdentity : public op::Op
+    {
+    public:
+        static constexpr NodeTypeInfo type_info{"CountingIdentity", 0};
+        const NodeTypeInfo& get_type_info() const override { return type_info; }
+        CountingIdentity(const Output<Node>& arg)
+            : Op({arg})
+        {
+            constructor_validate_and_infer_types();
+        }
+
+        void validate_and_infer_types() override
+        {
+            ++validations;
+            set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+        }
+
+        shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override
+        {
+            return make_shared<CountingIdentity>(new_args.at(0));
+        }
+
+        size_t validations = 0;
+    };
+    constexpr NodeTypeInfo CountingIdentity::type_info;
+}
+
+TEST(pass_manager, ordered_ops_follow_graph_changes)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto add = make_shared<op::v1::Add>(A, B);
+    auto f = make_shared<Function>(NodeVector{add}, ParameterVector{A, B});
+    EXPECT_EQ(f->get_ordered_ops().size(), 4);
+    // the cached order is returned while the graph is not changed
+    EXPECT_EQ(f->get_ordered_ops(), f->get_ordered_ops());
+
+    auto abs = make_shared<op::Abs>(add);
+    f->get_results()[0]->input(0).replace_source_output(abs);
+    auto ops = f->get_ordered_ops();
+    EXPECT_EQ(ops.size(), 5);
+    EXPECT_TRUE(validate_list(ops));
+    EXPECT_NE(find(ops.begin(), ops.end(), abs), ops.end());
+}
+
+TEST(pass_manager, validate_revalidates_changed_nodes)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto add = make_shared<op::v1::Add>(A, B);
+    auto abs = make_shared<op::Abs>(add);
+    auto f = make_shared<Function>(NodeVector{abs}, ParameterVector{A, B});
+    EXPECT_FALSE(add->inputs_changed());
+    EXPECT_FALSE(abs->inputs_changed());
+
+    // a new type of a parameter is propagated to all its consumers
+    A->set_partial_shape(PartialShape{4, 3});
+    B->set_partial_shape(PartialShape{4, 3});
+    // the manager runs Validate only after a pass changed the function, so it is run directly
+    pass::Validate validate;
+    validate.run_on_function(f);
+    EXPECT_EQ(f->get_output_shape(0), (Shape{4, 3}));
+    EXPECT_FALSE(abs->inputs_changed());
+
+    // a replaced input marks only its node
+    auto C = make_shared<op::Parameter>(element::f32, Shape{4, 3});
+    f->replace_parameter(1, C);
+    EXPECT_TRUE(add->inputs_changed());
+    EXPECT_FALSE(abs->inputs_changed());
+    validate.run_on_function(f);
+    EXPECT_FALSE(add->inputs_changed());
+    EXPECT_EQ(f->get_output_shape(0), (Shape{4, 3}));
+}
+
+TEST(pass_manager, validate_revalidates_nodes_depending_on_changed_values)
+{
+    auto data = make_shared<op::Parameter>(element::f32, PartialShape{2, Dimension::dynamic()});
+    auto k = make_shared<op::Convert>(op::Constant::create(element::i64, Shape{}, {3}), element::i32);
+    auto topk = make_shared<op::v3::TopK>(data, k, 1, "max", "value");
+    auto f = make_shared<Function>(topk->outputs(), ParameterVector{data});
+    EXPECT_EQ(f->get_output_partial_shape(0), (PartialShape{2, Dimension(0, 3)}));
+
+    // the type of the output of Convert stays the same, but the maximum value of k changes
+    k->input(0).replace_source_output(op::Constant::create(element::i64, Shape{}, {5}));
+    pass::Validate validate;
+    validate.run_on_function(f);
+    EXPECT_EQ(f->get_output_partial_shape(0), (PartialShape{2, Dimension(0, 5)}));
+    EXPECT_FALSE(topk->inputs_changed());
+}
+
+TEST(pass_manager, ordered_ops_cache_is_per_function)
+{
+    size_t sorts = 0;
+    auto counting_sort = [&sorts](const vector<shared_ptr<Node>>& nodes) {
+        ++sorts;
+        return topological_sort(nodes);
+    };
+
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto abs = make_shared<op::Abs>(A);
+    auto f = make_shared<Function>(NodeVector{abs}, ParameterVector{A});
+    f->set_topological_sort(counting_sort);
+
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto neg = make_shared<op::Negative>(B);
+    auto g = make_shared<Function>(NodeVector{neg}, ParameterVector{B});
+
+    f->get_ordered_ops();
+    f->get_ordered_ops();
+    EXPECT_EQ(sorts, 1);
+
+    // a change of another function keeps the cached order
+    neg->input(0).replace_source_output(make_shared<op::Abs>(B));
+    EXPECT_EQ(g->get_ordered_ops().size(), 4);
+    f->get_ordered_ops();
+    EXPECT_EQ(sorts, 1);
+
+    abs->input(0).replace_source_output(make_shared<op::Negative>(A));
+    EXPECT_EQ(f->get_ordered_ops().size(), 4);
+    EXPECT_EQ(sorts, 2);
+}
+
+TEST(pass_manager, validate_skips_unchanged_nodes)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto left = make_shared<CountingIdentity>(A);
+    auto right = make_shared<CountingIdentity>(B);
+    auto add = make_shared<op::v1::Add>(left, right);
+    auto sum = make_shared<CountingIdentity>(add);
+    auto f = make_shared<Function>(NodeVector{sum}, ParameterVector{A, B});
+    left->validations = right->validations = sum->validations = 0;
+
+    // nothing was changed
+    pass::Validate validate;
+    validate.run_on_function(f);
+    EXPECT_EQ(left->validations, 0);
+    EXPECT_EQ(right->validations, 0);
+    EXPECT_EQ(sum->validations, 0);
+
+    // a new input of the same type does not change the types of the consumers
+    left->input(0).replace_source_output(make_shared<op::Abs>(A));
+    validate.run_on_function(f);
+    EXPECT_EQ(left->validations, 1);
+    EXPECT_EQ(right->validations, 0);
+    EXPECT_EQ(sum->validations, 0);
+
+    // a new type is propagated only through the changed branch
+    A->set_partial_shape(PartialShape{1, 3});
+    validate.run_on_function(f);
+    EXPECT_EQ(left->validations, 2);
+    EXPECT_EQ(right->validations, 0);
+    // the broadcasted output of Add keeps its shape
+    EXPECT_EQ(sum->validations, 0);
+    EXPECT_EQ(f->get_output_shape(0), (Shape{2, 3}));
+}
+
+TEST(pass_manager, ordered_ops_cache_checks_replaced_parameters)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto f = make_shared<Function>(NodeVector{make_shared<op::Abs>(A)}, ParameterVector{A, B});
+    EXPECT_EQ(f->get_ordered_ops().size(), 4);
+
+    // the unused parameter is replaced without any change of node inputs
+    auto C = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    f->replace_parameter(1, C);
+    B.reset();
+    auto ops = f->get_ordered_ops();
+    EXPECT_EQ(ops.size(), 4);
+    EXPECT_NE(find(ops.begin(), ops.end(), C), ops.end());
 }
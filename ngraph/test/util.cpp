@@ -19,6 +19,10 @@
 #include <string>
 #include <vector>
 
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
 #include "gtest/gtest.h"
 
 #include "ngraph/file_util.hpp"
@@ -732,3 +736,70 @@ TEST(util, double_to_int)
     EXPECT_TRUE(double_to_int<int32_t>(x, floor_func) == 1);
     EXPECT_TRUE(double_to_int<int32_t>(x, round_func) == 2);
 }
+
+namespace
+{
+    // Resident memory of the process in bytes, 0 if it is not available
+    size_t resident_memory()
+    {
+#if defined(__linux__)
+        size_t pages = 0;
+        size_t resident = 0;
+        std::ifstream statm("/proc/self/statm");
+        if (statm >> pages >> resident)
+        {
+            return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        }
+#endif
+        return 0;
+    }
+}
+
+// Builds a graph of 100000 nodes, run it with --gtest_also_run_disabled_tests
+TEST(benchmark, DISABLED_clone_large_function)
+{
+    // Unrolled recurrent networks have hundreds of thousands of small nodes
+    const size_t steps = 50000;
+    size_t memory_before = resident_memory();
+    stopwatch timer;
+    timer.start();
+    auto data = make_shared<op::Parameter>(element::f32, Shape{1, 16});
+    auto state = make_shared<op::Parameter>(element::f32, Shape{1, 16});
+    Output<Node> value = state;
+    for (size_t i = 0; i < steps; i++)
+    {
+        auto add = make_shared<op::v1::Add>(value, data);
+        value = make_shared<op::Relu>(add);
+    }
+    auto f = make_shared<Function>(OutputVector{value}, ParameterVector{data, state});
+    timer.stop();
+    size_t memory_after = resident_memory();
+    size_t nodes = f->get_ops().size();
+    NGRAPH_INFO << "build " << nodes << " nodes     " << timer.get_milliseconds() << "ms";
+    if (memory_after > memory_before)
+    {
+        NGRAPH_INFO << "graph memory           " << (memory_after - memory_before) / nodes
+                    << " bytes per node";
+    }
+
+    timer.start();
+    auto g = clone_function(*f);
+    timer.stop();
+    NGRAPH_INFO << "clone_function         " << timer.get_milliseconds() << "ms";
+
+    // The order cached by the constructor is dropped by a change of the graph
+    auto last = value.get_node_shared_ptr();
+    last->input(0).replace_source_output(make_shared<op::Abs>(last->input_value(0)));
+    timer.start();
+    auto ordered_ops = f->get_ordered_ops();
+    timer.stop();
+    NGRAPH_INFO << "get_ordered_ops        " << timer.get_milliseconds() << "ms";
+
+    timer.start();
+    f->get_ordered_ops();
+    timer.stop();
+    NGRAPH_INFO << "get_ordered_ops cached " << timer.get_milliseconds() << "ms";
+
+    EXPECT_EQ(g->get_ops().size(), nodes);
+    EXPECT_EQ(ordered_ops.size(), nodes + 1);
+}